@@ -130,6 +130,55 @@ namespace rlogic
         Run(state, scriptSrc);
     }
 
+    static void BM_GetPropertyWideStruct(benchmark::State& state)
+    {
+        const int64_t structSize = state.range(0);
+        const std::string scriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                local wide = {{}}
+                for i = 0,{},1 do
+                    wide["param"..tostring(i)] = Type:Int32()
+                end
+                IN.wide = wide
+                OUT.param = Type:Int32()
+            end
+            function run(IN,OUT)
+                local result = 0
+                for i = 0,10000,1 do
+                    result = result + IN.wide.param0 + IN.wide.param{}
+                end
+                OUT.param = result
+            end
+        )", structSize, structSize);
+        Run(state, scriptSrc);
+    }
+
+    static void BM_GetChildByNameWideStruct(benchmark::State& state)
+    {
+        const int64_t structSize = state.range(0);
+        const std::string scriptSrc = fmt::format(R"(
+            function interface(IN,OUT)
+                for i = 0,{},1 do
+                    IN["param"..tostring(i)] = Type:Int32()
+                end
+            end
+            function run(IN,OUT)
+            end
+        )", structSize);
+
+        LogicEngine logicEngine;
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Base);
+        const LuaScript* script = logicEngine.createLuaScript(scriptSrc, config);
+        const Property* inputs = script->getInputs();
+        const std::string lastChildName = fmt::format("param{}", structSize);
+
+        while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(inputs->getChild(lastChildName));
+        }
+    }
+
     struct Userdata
     {
         inline static const char* const name = "Userdata";
@@ -402,6 +451,10 @@ namespace rlogic
     BENCHMARK(BM_GetPropertyGlobal)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetProperty)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetPropertyNested)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
+    // Access to fields of a struct depending on its width
+    // ARG: number of fields in struct
+    BENCHMARK(BM_GetPropertyWideStruct)->Arg(10)->Arg(100)->Arg(250)->Unit(benchmark::TimeUnit::kMillisecond);
+    BENCHMARK(BM_GetChildByNameWideStruct)->Arg(10)->Arg(100)->Arg(250);
     // for comparison: Simple userdata with pure sol
     BENCHMARK(BM_GetSolUserdataIndex)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
     BENCHMARK(BM_GetSolUserdataBind)->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::TimeUnit::kMillisecond);
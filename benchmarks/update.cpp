@@ -132,14 +132,16 @@ namespace rlogic
     // first in the list has its 'dirty_trigger' value changed, all scripts in the change will be
     // triggered for re-execution, whereas setting the trigger on the last script will only have the
     // last script executed
-    // Read the results like this: the higher the arg (0 .. 99) the faster the update should be, ideally
-    // when the arg is close to 99, the time to update should be close to zero
+    // Read the results like this: the higher the first arg (0 .. scriptCount-1) the faster the update should be, ideally
+    // when the arg is close to scriptCount-1, the time to update should be close to zero
+    // The second arg is the total count of scripts - with the same number of dirty scripts the update time
+    // should be the same regardless of the total count of scripts (i.e. update cost scales with dirty count only)
     static void BM_Update_IsFasterWithFewerDirtyScripts(benchmark::State& state)
     {
         LogicEngine logicEngine;
 
         const int64_t scriptToSetDirty = state.range(0);
-        constexpr int64_t scriptCount = 100;
+        const int64_t scriptCount = state.range(1);
 
         const std::string scriptSrc = R"(
             function interface(IN,OUT)
@@ -195,9 +197,15 @@ namespace rlogic
             success = logicEngine.update();
             assert(success);
         }
+
+        state.counters["dirtyScripts"] = static_cast<double>(scriptCount - scriptToSetDirty);
     }
 
-    BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)->Arg(0)->Arg(49)->Arg(99)->Unit(benchmark::kMillisecond);
+    BENCHMARK(BM_Update_IsFasterWithFewerDirtyScripts)
+        ->Args({ 0, 100 })->Args({ 49, 100 })->Args({ 99, 100 })
+        ->Args({ 999, 1000 })->Args({ 4999, 5000 })
+        ->Args({ 990, 1000 })->Args({ 4990, 5000 })
+        ->Unit(benchmark::kMicrosecond);
 }
 
 
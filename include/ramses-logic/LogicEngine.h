@@ -17,6 +17,7 @@
 #include "ramses-logic/ErrorData.h"
 #include "ramses-logic/LogicEngineReport.h"
 #include "ramses-logic/LuaConfig.h"
+#include "ramses-logic/OutputSnapshot.h"
 #include "ramses-logic/SaveFileConfig.h"
 #include "ramses-logic/WarningData.h"
 #include "ramses-logic/PropertyLink.h"
@@ -24,6 +25,8 @@
 
 #include <vector>
 #include <string_view>
+#include <chrono>
+#include <utility>
 
 namespace ramses
 {
@@ -168,6 +171,28 @@ namespace rlogic
             const LuaConfig& config = {},
             std::string_view scriptName = "");
 
+        /**
+        * Creates a new Lua script which is an instance of \p prototype, i.e. it has same source code,
+        * module dependencies and interface as the prototype. Use this instead of #createLuaScript when
+        * creating many scripts from same source code - the instance reuses already compiled code and
+        * interface of prototype, it neither parses the source code nor executes the 'interface' function.
+        * The instance has its own inputs/outputs (initialized to default values, not copied from prototype)
+        * and its own Lua environment, i.e. 'init' function is executed for it and it has its own GLOBAL table.
+        * Source and byte code shared by instances is stored only once when saved to file and shared
+        * again after loading.
+        *
+        * Attention! This method clears all previous errors! See also docs of #getErrors()
+        *
+        * @param prototype script created by this logic engine to create instance of
+        * @param scriptName name to assign to the script once it's created
+        * @return a pointer to the created object or nullptr if
+        * something went wrong during creation. In that case, use #getErrors() to obtain errors.
+        * The script can be destroyed by calling the #destroy method, independently of prototype
+        */
+        RLOGIC_API LuaScript* createLuaScriptInstance(
+            const LuaScript& prototype,
+            std::string_view scriptName = "");
+
         /**
         * Creates a new Lua interface from a source string. Refer to the #rlogic::LuaInterface class
         * for requirements which Lua interface must fulfill in order to be added to the #LogicEngine.
@@ -484,6 +509,135 @@ namespace rlogic
          */
         RLOGIC_API bool update();
 
+        /**
+         * Same as #update, but stops executing #rlogic::LogicNode's once the given budget is exhausted, so that
+         * a large amount of nodes which need update (e.g. after setting many inputs at once) can be spread over several frames.
+         * The budget is checked before each node execution, at least one node is always executed so that every call makes progress
+         * (a single node is never interrupted, i.e. the time budget can be exceeded by execution time of the last executed node).
+         * If the budget was exhausted, \p updateCompleted is false and the next call of #updateWithBudget continues
+         * with the remaining nodes in the same order. Inputs set between the calls are processed in the continued update only
+         * if they belong to a node not reached yet, otherwise in the following one. Creating or destroying
+         * nodes or links between the calls restarts the update from the beginning. A call to #update always executes all remaining
+         * nodes. The number of deferred nodes is available in #rlogic::LogicEngineReport::getDeferredNodeCount.
+         * Parallel update (see #setParallelUpdateWorkerCount) is not used when updating with budget.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param timeBudget time after which no more nodes are executed
+         * @param maxExecutedNodes maximum number of nodes executed in this call
+         * @param updateCompleted set to true if all nodes which needed update were executed, false if some were left for next call
+         * @return true if the update was successful, false otherwise
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool updateWithBudget(std::chrono::microseconds timeBudget, size_t maxExecutedNodes, bool& updateCompleted);
+
+        /**
+         * Same as #update, but executes only those #rlogic::LogicNode's which are needed to calculate the given properties,
+         * i.e. the nodes owning the properties and all nodes they depend on (directly or indirectly) via links
+         * (see #link). Of these nodes only those which need update are executed. Weak links (see #linkWeak) are not
+         * considered as dependencies. All other nodes which need update are left for the next #update. This can be used
+         * to obtain an up-to-date value of a single output (e.g. #rlogic::AnchorPoint coordinates) in the middle of a frame
+         * without paying for update of the whole logic network. Values propagated to nodes outside of the requested part
+         * are kept and processed by the next #update.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param requiredOutputs properties whose values are needed, typically outputs of logic nodes created by this #LogicEngine instance
+         * @return true if the update was successful, false otherwise
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool update(const std::vector<const Property*>& requiredOutputs);
+
+        /**
+         * Sets values of many input properties at once. Has the same effect as calling #rlogic::Property::set for each of the given
+         * properties, but is cheaper when setting hundreds or thousands of values per frame (e.g. when feeding data received from
+         * another system into bindings and scripts). All values are validated first, if any of them can't be set (see #rlogic::Property::set
+         * for the rules), none of the values is applied. Values equal to the current value of the property don't cause update
+         * of the owning #rlogic::LogicNode (except for binding inputs, same as with #rlogic::Property::set).
+         * The template parameter T has the same restrictions as with #rlogic::Property::set, to set values of different
+         * types call this method once per type.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param values pairs of property and its new value, properties must belong to logic nodes created by this #LogicEngine instance
+         * @return true if all values were set, false if none was set due to an error.
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        template <typename T>
+        bool setPropertyValues(const std::vector<std::pair<Property*, T>>& values);
+
+        /**
+         * Finds property by its path, e.g. \c "MyScript.inputs.struct.array[3]". The path starts with the name of a #rlogic::LogicNode
+         * (which can contain dots), followed by \c ".inputs" or \c ".outputs" and then by names of nested struct fields prefixed with
+         * \c '.' and indices of array elements in brackets (0-based, same as #rlogic::Property::getChild(size_t)).
+         * If there are several logic nodes with the same name, the first one found is used.
+         * The lookup involves string comparisons, it is meant to be done once (e.g. during initialization), the returned pointer can then
+         * be used to get and set the value without any lookup as long as the owning logic node exists.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param path path of the property
+         * @return the property or nullptr if \p path is malformed or no property is found.
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        [[nodiscard]] RLOGIC_API Property* resolvePropertyPath(std::string_view path);
+
+        /**
+         * Selects properties whose values are published in #rlogic::OutputSnapshot (see #getOutputSnapshot) at the end of each complete
+         * #update or #updateWithBudget (i.e. not when update with budget was interrupted and not after #update of required outputs only).
+         * Publishing is cheap (values are copied into storage allocated here, only a string value allocates when it grows beyond any
+         * value previously stored at its position) and doesn't block a concurrent reader of the snapshot, so this is
+         * the preferred way to pass logic results to a render thread running in parallel to the next update. Values in the snapshot are
+         * ordered as the properties given here. Selecting properties discards any previously published snapshot and must not be done
+         * while another thread reads the snapshot. Snapshot values of properties of logic nodes destroyed later keep their last published value.
+         * Loading content (see #loadFromFile) clears the selection and publishes an empty snapshot (with no values), unlike selecting
+         * properties this does not discard published snapshots, so the snapshot can be read by another thread also while loading.
+         *
+         * Attention! This method clears all previous errors! See also docs of #getErrors()
+         *
+         * @param properties properties of primitive type (see #rlogic::Property::get) owned by logic nodes of this #LogicEngine instance,
+         *                   empty vector stops publishing
+         * @return true if the selection was successful, false otherwise (previous selection is kept).
+         * In case of an error, use #getErrors() to obtain errors.
+         */
+        RLOGIC_API bool setOutputSnapshotProperties(const std::vector<const Property*>& properties);
+
+        /**
+         * Returns the snapshot of values of properties selected in #setOutputSnapshotProperties. The snapshot object is owned by this
+         * #LogicEngine instance and stays valid as long as the instance exists, see #rlogic::OutputSnapshot for rules of reading it
+         * from another thread.
+         *
+         * @return snapshot of selected property values
+         */
+        [[nodiscard]] RLOGIC_API OutputSnapshot& getOutputSnapshot();
+
+        /**
+         * Returns the current update generation, which is the number of calls to #update, #updateWithBudget and #update of required
+         * outputs executed by this #LogicEngine instance (it is not reset by #loadFromFile). Every property remembers the generation in which its
+         * value changed (see #rlogic::Property::getChangeGeneration): values changed during an update get the generation which is returned here
+         * after that update, input values set by the user before an update get the generation of the update which consumes them.
+         * This allows to forward only changed values after update instead of comparing all values of interest:
+         *
+         * \code{.cpp}
+         *   const uint64_t generation = logicEngine.getUpdateGeneration();
+         *   logicEngine.update();
+         *   for (const Property* changed : logicEngine.collectChangedProperties(generation)) { ... }
+         * \endcode
+         *
+         * @return current update generation
+         */
+        [[nodiscard]] RLOGIC_API uint64_t getUpdateGeneration() const;
+
+        /**
+         * Collects properties of all logic nodes of this #LogicEngine instance whose value changed after given update generation,
+         * see #getUpdateGeneration and #rlogic::LogicNode::collectChangedProperties. Logic nodes in which nothing changed are skipped
+         * without visiting their properties.
+         *
+         * @param sinceGeneration generation after which the value must have changed
+         * @return properties whose value changed
+         */
+        [[nodiscard]] RLOGIC_API std::vector<const Property*> collectChangedProperties(uint64_t sinceGeneration) const;
+
         /**
         * Enables collecting of statistics during call to #update which can be obtained using #getLastUpdateReport.
         * Once enabled every subsequent call to #update will be instructed to collect various statistical data
@@ -543,6 +697,119 @@ namespace rlogic
         */
         RLOGIC_API void setStatisticsLogLevel(ELogMessageType logLevel);
 
+        /**
+        * Enables concurrent execution of independent #rlogic::LogicNode's during #update.
+        * When enabled, #update groups the logic nodes into levels based on their links - nodes within one level don't
+        * depend on each other and are all executed before any node of the next level. Nodes which neither run Lua code
+        * nor access Ramses objects (#rlogic::AnimationNode and #rlogic::TimerNode) are distributed over \p workerCount
+        * worker threads and the calling thread, so are #rlogic::LuaScript's if several Lua states are used (see #setLuaStateCount).
+        * All other nodes are executed on the calling thread. Link
+        * propagation happens on the calling thread after each level, in the same order as in a serial #update.
+        * Note that a value propagated over a weak link (see #linkWeak) to a node of the same level will
+        * be received by that node only in the next #update.
+        * This pays off for graphs with many independent animation nodes, by default the parallel update is disabled.
+        *
+        * @param workerCount number of worker threads used in addition to the calling thread, 0 disables parallel update.
+        */
+        RLOGIC_API void setParallelUpdateWorkerCount(size_t workerCount);
+
+        /**
+        * Sets the number of Lua states used to execute #rlogic::LuaScript's. By default all Lua objects share one Lua state,
+        * which allows only one script to be executed at a time. With more than one state, scripts are distributed over the states
+        * in round-robin order of their creation (or of their order in a loaded file), and scripts of different states can be executed
+        * concurrently by the parallel update (see #setParallelUpdateWorkerCount). Scripts of the same state are always executed
+        * one after another. #rlogic::LuaModule's and #rlogic::LuaInterface's are created in the first state, a module is additionally
+        * loaded into every other state which has a script using it, i.e. a module is executed once per state and modules must not
+        * rely on sharing data between scripts of different states.
+        * The number of states is kept when loading from file (see #loadFromFile), saved files do not depend on it.
+        * Note that when scripts are executed concurrently, the Lua debug log functions (see #rlogic::LuaConfig::enableDebugLogFunctions)
+        * and thus the log handler (see #rlogic::Logger::SetLogHandler) can be called from worker threads.
+        *
+        * @param luaStateCount number of Lua states, must be at least 1
+        * @return true if successful, false if \p luaStateCount is 0 or there already are Lua scripts, modules or interfaces
+        */
+        RLOGIC_API bool setLuaStateCount(size_t luaStateCount);
+
+        /**
+        * Enables or disables automatic Lua garbage collection. By default Lua executes incremental garbage collection steps
+        * whenever Lua code allocates memory, i.e. also in the middle of #update while executing #rlogic::LuaScript's.
+        * When disabled, garbage is collected only by #collectLuaGarbage, which allows the application to collect garbage at
+        * a point of its choice, e.g. after #update or in idle time.
+        * Attention! When automatic garbage collection is disabled, memory used by Lua grows until #collectLuaGarbage is called.
+        * The setting applies to all Lua states (see #setLuaStateCount) and is kept when loading from file.
+        *
+        * @param enabled true (default) to let Lua collect garbage automatically, false to collect only in #collectLuaGarbage
+        */
+        RLOGIC_API void enableAutomaticLuaGarbageCollection(bool enabled);
+
+        /**
+        * Sets parameters of the incremental Lua garbage collector, see 'collectgarbage' in the Lua manual for details.
+        * The Lua runtime used by this library (Lua 5.1 or LuaJIT) provides only the incremental collector, there is no generational mode.
+        * The parameters apply to all Lua states (see #setLuaStateCount) and are kept when loading from file.
+        *
+        * @param pausePercent how long the collector waits before starting a new cycle, in percent of memory in use after previous
+        *                     cycle (Lua default is 200, i.e. new cycle starts when memory use doubles)
+        * @param stepMultiplierPercent speed of the collector relative to memory allocation (Lua default is 200), must be at least 100
+        * @return true if successful, false if parameters are invalid
+        */
+        RLOGIC_API bool setLuaGarbageCollectorParameters(uint32_t pausePercent, uint32_t stepMultiplierPercent);
+
+        /**
+        * Executes incremental Lua garbage collection steps until a full collection cycle is finished in all Lua states or
+        * \p timeBudget elapsed. At least one step is executed in every Lua state, even with zero budget. Time spent in this
+        * method is reported by #rlogic::LogicEngineReport::getLuaGarbageCollectionTime of the next #update.
+        * Use together with #enableAutomaticLuaGarbageCollection to control when Lua collects garbage.
+        *
+        * @param timeBudget time after which no more steps are executed
+        * @return true if a collection cycle finished in all Lua states, false if the budget was exhausted before
+        */
+        RLOGIC_API bool collectLuaGarbage(std::chrono::microseconds timeBudget);
+
+        /**
+        * Enables use of a process-wide cache of compiled Lua scripts and modules, shared by all #LogicEngine instances
+        * which enabled it. When several logic engines create or load the same Lua source code (with same #rlogic::EFeatureLevel
+        * and standard modules), only the first one compiles it - the others load the compiled byte code and reuse the extracted
+        * interface of the script (unless the script uses user modules), which is significantly faster.
+        * Lua objects loaded from file with pre-compiled byte code (see #rlogic::ELuaSavingMode) do not need the cache.
+        * An entry is kept only as long as some Lua object compiled from its source code exists (in any logic engine),
+        * so the cache does not grow beyond the Lua code which is in use.
+        * The cache is thread-safe, logic engines using it can be used from different threads.
+        * The setting is kept when loading from file and has effect on Lua objects created or loaded afterwards. Disabled by default.
+        *
+        * @param enabled true to use the shared compilation cache, false to compile every script and module
+        */
+        RLOGIC_API void enableSharedLuaCompilationCache(bool enabled);
+
+        /**
+        * Removes all entries from the process-wide cache of compiled Lua scripts and modules,
+        * see #enableSharedLuaCompilationCache. Existing Lua objects are not affected, but their source code
+        * will be compiled again when used by Lua objects created afterwards.
+        */
+        RLOGIC_API static void ClearSharedLuaCompilationCache();
+
+        /**
+        * By default every #rlogic::AnchorPoint and #rlogic::SkinBinding is executed in every #update, because they read
+        * Ramses node transformations which can be modified also outside of the logic engine.
+        * When transform change tracking is enabled, these nodes are executed only when needed - when a #rlogic::RamsesNodeBinding
+        * bound to one of the Ramses nodes they depend on (or to any of its parent nodes) modified its transformation,
+        * or when a #rlogic::RamsesCameraBinding of an #rlogic::AnchorPoint modified its camera's viewport or frustum.
+        * The dependencies are derived from the Ramses scene hierarchy at the time of next #update after creating, destroying
+        * or loading logic objects. If the Ramses scene is modified directly (transformations or hierarchy of nodes)
+        * while tracking is enabled, #invalidateRamsesTransforms must be called, otherwise the tracked nodes may keep outdated values.
+        * Note that a node binding which is executed after a tracked node (i.e. it is not linked to be executed before it)
+        * causes the tracked node to be executed only in the next #update.
+        *
+        * @param enabled true to enable tracking, false (default) to execute anchor points and skin bindings in every #update
+        */
+        RLOGIC_API void enableTransformChangeTracking(bool enabled);
+
+        /**
+        * Notifies the logic engine that Ramses node transformations or scene hierarchy were modified directly (i.e. not
+        * via bindings), all #rlogic::AnchorPoint and #rlogic::SkinBinding objects will be executed in next #update.
+        * Has effect only if transform change tracking is enabled, see #enableTransformChangeTracking.
+        */
+        RLOGIC_API void invalidateRamsesTransforms();
+
         /**
          * Links a property of a #rlogic::LogicNode to another #rlogic::Property of another #rlogic::LogicNode.
          * After linking, calls to #update will propagate the value of \p sourceProperty to
@@ -558,9 +825,9 @@ namespace rlogic
          * - \p targetProperty is not an input (see #rlogic::LogicNode::getInputs())
          * - either \p sourceProperty or \p targetProperty is not a primitive property (you have to link sub-properties
          *   of structs and arrays individually)
+         * - the link would form a cycle in the node dependency graph (the error names the nodes and properties forming the cycle)
          *
-         * Creating links which form a cycle in the node dependency graph will not fail right away but during the next call
-         * to #update(). Links are directional, it is OK to have A->B, A->C and B->C, but is not OK to have
+         * Links are directional, it is OK to have A->B, A->C and B->C, but is not OK to have
          * A->B->C->A. Cycles are allowed only under special conditions when using a weak link (see #linkWeak).
          *
          * After calling #link, the value of the \p targetProperty will not change until the next call to #update. Creating
@@ -721,6 +988,8 @@ namespace rlogic
          * #LogicEngine loaded from the file has no #rlogic::RamsesBinding objects which point to a Ramses scene object.
          * Otherwise, the call to #loadFromFile will fail with an error. In case of errors, the #LogicEngine
          * may be left in an inconsistent state.
+         * Successful loading clears the properties selected for #rlogic::OutputSnapshot and publishes an empty snapshot,
+         * another thread can keep reading the snapshot while loading (see #setOutputSnapshotProperties).
          * For more in-depth information regarding saving and loading, refer to the online documentation at
          * https://ramses-logic.readthedocs.io/en/latest/api.html#saving-loading-from-file
          *
@@ -882,6 +1151,15 @@ namespace rlogic
         template <typename T>
         [[nodiscard]] RLOGIC_API DataArray* createDataArrayInternal(const std::vector<T>& data, std::string_view name);
 
+        /**
+        * Internal implementation of #setPropertyValues
+        *
+        * @param values pairs of property and its new value
+        * @return true if all values were set, false otherwise
+        */
+        template <typename T>
+        RLOGIC_API bool setPropertyValuesInternal(const std::vector<std::pair<Property*, T>>& values);
+
         /// Internal static helper to validate type
         template <typename T>
         static void StaticTypeCheck();
@@ -916,6 +1194,13 @@ namespace rlogic
         return createDataArrayInternal<T>(data, name);
     }
 
+    template <typename T>
+    bool LogicEngine::setPropertyValues(const std::vector<std::pair<Property*, T>>& values)
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call setPropertyValues<T> only with types which have a value! Read the docs of the method!");
+        return setPropertyValuesInternal<T>(values);
+    }
+
     template <typename T>
     void LogicEngine::StaticTypeCheck()
     {
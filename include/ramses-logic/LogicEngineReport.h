@@ -79,6 +79,32 @@ namespace rlogic
         */
         [[nodiscard]] RLOGIC_API size_t getTotalLinkActivations() const;
 
+        /**
+        * Obtain the number of logic nodes which needed update but were not executed because the budget
+        * given to #rlogic::LogicEngine::updateWithBudget was exhausted. These nodes will be executed in a following update.
+        * Always 0 after #rlogic::LogicEngine::update.
+        *
+        * @return the number of nodes left for next update
+        */
+        [[nodiscard]] RLOGIC_API size_t getDeferredNodeCount() const;
+
+        /**
+        * Obtain the memory used by Lua (in bytes, summed over all Lua states, see #rlogic::LogicEngine::setLuaStateCount)
+        * at the end of the update.
+        *
+        * @return memory used by Lua in bytes
+        */
+        [[nodiscard]] RLOGIC_API size_t getLuaMemoryUsage() const;
+
+        /**
+        * Time spent in #rlogic::LogicEngine::collectLuaGarbage since the previous update, i.e. between the previous
+        * and this update. Garbage collection steps which Lua executes automatically while running scripts
+        * (see #rlogic::LogicEngine::enableAutomaticLuaGarbageCollection) are part of node execution times and not included.
+        *
+        * @return time spent in explicit Lua garbage collection
+        */
+        [[nodiscard]] RLOGIC_API std::chrono::microseconds getLuaGarbageCollectionTime() const;
+
         /**
         * Default constructor of LogicEngineReport.
         */
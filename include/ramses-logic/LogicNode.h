@@ -10,7 +10,9 @@
 
 #include "ramses-logic/LogicObject.h"
 
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace rlogic::internal
 {
@@ -64,6 +66,44 @@ namespace rlogic
          */
         [[nodiscard]] RLOGIC_API const Property* getOutputs() const;
 
+        /**
+         * Assigns this #LogicNode to an update rate group. A node with update rate divisor \c N is executed
+         * (if any of its inputs changed) only in every \c Nth call of #rlogic::LogicEngine::update, in the other updates
+         * it stays dirty and nodes which depend on it keep their previous input values. This can be used for low priority
+         * nodes (e.g. ambient animations or diagnostics) to reduce update cost, order of execution and link propagation
+         * are not affected. For a target frequency use a divisor matching the application's update rate (e.g. divisor 4 for 15Hz
+         * when updating logic at 60Hz). Updates of required outputs (#rlogic::LogicEngine::update with list of properties)
+         * execute all required nodes regardless of their update rate.
+         * The update rate divisor is stored when saving the logic engine to file. Default value is 1 (executed in every update).
+         * The divisor is not bound to a feature level: a divisor other than 1 is written as an optional field which versions of
+         * the library without update rate support ignore when loading the file, so they execute the node in every update.
+         * This fallback is intended - the divisor only controls how often a node is executed, never which outputs it computes
+         * from given inputs, so such versions produce the same results, just more often.
+         *
+         * @param divisor update rate divisor, must be greater than 0
+         * @return true if successful, false if \p divisor is 0
+         */
+        RLOGIC_API bool setUpdateRateDivisor(uint32_t divisor);
+
+        /**
+         * Returns the update rate divisor of this #LogicNode, see #setUpdateRateDivisor.
+         *
+         * @return update rate divisor
+         */
+        [[nodiscard]] RLOGIC_API uint32_t getUpdateRateDivisor() const;
+
+        /**
+         * Collects input and output properties of this #LogicNode whose value changed after given update generation,
+         * i.e. properties whose #rlogic::Property::getChangeGeneration is greater than \p sinceGeneration.
+         * Only properties of primitive type are collected. If nothing changed in this #LogicNode since \p sinceGeneration,
+         * the cost of this call does not depend on the number of its properties.
+         * See #rlogic::LogicEngine::getUpdateGeneration for details on generations.
+         *
+         * @param sinceGeneration generation after which the value must have changed (typically #rlogic::LogicEngine::getUpdateGeneration before last #rlogic::LogicEngine::update)
+         * @return properties whose value changed
+         */
+        [[nodiscard]] RLOGIC_API std::vector<const Property*> collectChangedProperties(uint64_t sinceGeneration) const;
+
         /**
         * Destructor of #LogicNode
         */
@@ -10,6 +10,8 @@
 
 #include "ramses-logic/LogicObject.h"
 
+#include <cstddef>
+
 namespace rlogic::internal
 {
     class LuaModuleImpl;
@@ -61,6 +63,16 @@ namespace rlogic
     class LuaModule : public LogicObject
     {
     public:
+        /**
+        * Returns number of bytes of Lua memory currently owned by this module, i.e. allocated when the module was loaded
+        * (in all Lua states it is loaded into, see #rlogic::LogicEngine::setLuaStateCount) and not freed yet by the Lua
+        * garbage collector. Memory allocated by module functions when called from a #rlogic::LuaScript is accounted to the script.
+        * Always returns 0 if built with LuaJIT (see ramses-logic_USE_LUAJIT), LuaJIT does not support custom memory allocation.
+        *
+        * @return Lua memory owned by this module in bytes
+        */
+        [[nodiscard]] RLOGIC_API size_t getMemoryUsage() const;
+
         /**
         * Destructor of #LuaModule
         */
@@ -81,6 +81,28 @@ namespace rlogic
         */
         explicit LuaScript(std::unique_ptr<internal::LuaScriptImpl> impl) noexcept;
 
+        /**
+        * Returns number of bytes of Lua memory currently owned by this script, i.e. allocated while the script was loaded or
+        * its run() function was executed (including functions of modules it called) and not freed yet by the Lua garbage collector.
+        * Garbage is not freed immediately, therefore the value includes garbage not collected yet,
+        * see #rlogic::LogicEngine::collectLuaGarbage.
+        * Always returns 0 if built with LuaJIT (see ramses-logic_USE_LUAJIT), LuaJIT does not support custom memory allocation.
+        *
+        * @return Lua memory owned by this script in bytes
+        */
+        [[nodiscard]] RLOGIC_API size_t getMemoryUsage() const;
+
+        /**
+        * Limits Lua memory this script can own (see #getMemoryUsage). If an allocation during execution of the script's run() function
+        * would exceed the limit, the allocation fails and #rlogic::LogicEngine::update reports a runtime error of this script.
+        * Note that garbage which was not collected yet counts towards the limit, the limit should therefore leave enough headroom
+        * for the Lua garbage collector settings used (see #rlogic::LogicEngine::setLuaGarbageCollectorParameters).
+        * The limit is not saved to file and has no effect if built with LuaJIT (see ramses-logic_USE_LUAJIT).
+        *
+        * @param maxBytes maximum Lua memory owned by this script in bytes, 0 for no limit (default)
+        */
+        RLOGIC_API void setMemoryLimit(size_t maxBytes);
+
         /**
         * Destructor of LuaScript
         */
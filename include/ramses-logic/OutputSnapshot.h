@@ -0,0 +1,130 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/APIExport.h"
+#include "ramses-logic/EPropertyType.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+namespace rlogic::internal
+{
+    class OutputSnapshotImpl;
+}
+
+namespace rlogic
+{
+    /**
+    * Copy of values of selected properties, published by #rlogic::LogicEngine at the end of each complete #rlogic::LogicEngine::update
+    * (see #rlogic::LogicEngine::setOutputSnapshotProperties). The snapshot is meant to be read from another thread (e.g. a render thread)
+    * while the #rlogic::LogicEngine already executes the next update. Publishing and reading never block each other.
+    *
+    * Reading is done by one reader thread at a time: the reader calls #acquireLatest to obtain the latest published values and then reads
+    * them using #get. The values obtained by #get don't change until the next call to #acquireLatest, i.e. all values read in between
+    * are consistent and come from the same update. Other methods of the #rlogic::LogicEngine must not be called from the reader thread.
+    * Reading can continue while the #rlogic::LogicEngine loads new content (see #rlogic::LogicEngine::loadFromFile), which publishes
+    * a snapshot without values, but must stop while properties are selected (see #rlogic::LogicEngine::setOutputSnapshotProperties).
+    */
+    class OutputSnapshot
+    {
+    public:
+        /**
+        * Makes the latest values published by #rlogic::LogicEngine available for reading. Wait-free, can be called concurrently
+        * to #rlogic::LogicEngine::update.
+        *
+        * @return true if newer values were acquired, false if no update was published since last call.
+        */
+        RLOGIC_API bool acquireLatest();
+
+        /**
+        * Returns the version of currently acquired values. The version is increased with every published snapshot,
+        * it is 0 if no snapshot was acquired yet after selecting the properties (see #rlogic::LogicEngine::setOutputSnapshotProperties).
+        *
+        * @return version of acquired values
+        */
+        [[nodiscard]] RLOGIC_API uint64_t getVersion() const;
+
+        /**
+        * Returns the number of values in the snapshot, which is the number of properties selected in #rlogic::LogicEngine::setOutputSnapshotProperties.
+        *
+        * @return number of values in snapshot
+        */
+        [[nodiscard]] RLOGIC_API size_t getValueCount() const;
+
+        /**
+        * Returns the acquired value of the property at position \p index in the list of properties given to
+        * #rlogic::LogicEngine::setOutputSnapshotProperties. Same rules apply to template parameter T as in #rlogic::Property::get.
+        * Before the first snapshot was acquired the values are those the properties had when they were selected.
+        *
+        * @param index position of property in the selected properties
+        * @return the value or std::nullopt if \p index is out of range or T does not match the type of the property.
+        */
+        template <typename T> [[nodiscard]] std::optional<T> get(size_t index) const;
+
+        /**
+        * Constructor of OutputSnapshot. User is not supposed to call this - snapshot is owned by #rlogic::LogicEngine
+        *
+        * @param impl implementation details of the OutputSnapshot
+        */
+        explicit OutputSnapshot(std::unique_ptr<internal::OutputSnapshotImpl> impl) noexcept;
+
+        /**
+        * Destructor of OutputSnapshot
+        */
+        ~OutputSnapshot() noexcept;
+
+        /**
+        * Copy Constructor of OutputSnapshot is deleted because snapshot is owned by #rlogic::LogicEngine
+        *
+        * @param other snapshot to copy from
+        */
+        OutputSnapshot(const OutputSnapshot& other) = delete;
+
+        /**
+        * Move Constructor of OutputSnapshot is deleted because snapshot is owned by #rlogic::LogicEngine
+        *
+        * @param other snapshot to move from
+        */
+        OutputSnapshot(OutputSnapshot&& other) = delete;
+
+        /**
+        * Assignment operator of OutputSnapshot is deleted because snapshot is owned by #rlogic::LogicEngine
+        *
+        * @param other snapshot to assign from
+        */
+        OutputSnapshot& operator=(const OutputSnapshot& other) = delete;
+
+        /**
+        * Move assignment operator of OutputSnapshot is deleted because snapshot is owned by #rlogic::LogicEngine
+        *
+        * @param other snapshot to move from
+        */
+        OutputSnapshot& operator=(OutputSnapshot&& other) = delete;
+
+        /**
+        * Implementation details of the OutputSnapshot class
+        */
+        std::unique_ptr<internal::OutputSnapshotImpl> m_impl;
+
+    private:
+        /**
+         * Internal implementation of #get
+         */
+        template <typename T> [[nodiscard]] RLOGIC_API std::optional<T> getInternal(size_t index) const;
+    };
+
+    template <typename T> std::optional<T> OutputSnapshot::get(size_t index) const
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call get<T> only with types which have a value! Read the docs of the method!");
+        return getInternal<T>(index);
+    }
+}
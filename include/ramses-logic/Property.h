@@ -136,6 +136,40 @@ namespace rlogic
         */
         template <typename T> bool set(T value);
 
+        /**
+        * Sets the values of all elements of this property at once. The property must be of type #rlogic::EPropertyType::Array
+        * with elements of primitive type matching T (same rules apply to template parameter T as in #get()).
+        * This is equivalent to calling #set() on every child, but all values are validated first and the owning
+        * #rlogic::LogicNode is marked for update only once - prefer this method when setting big arrays (e.g. uniform arrays).
+        *
+        * #setArray() will report an error and not modify any element if any of the elements is linked, see #hasIncomingLink().
+        *
+        * @param values pointer to \p count contiguous values, element i is set to values[i], may be nullptr if \p count is 0
+        * @param count number of values, must be equal to #getChildCount()
+        * @return true if setting all values was successful, false otherwise.
+        */
+        template <typename T> bool setArray(const T* values, size_t count);
+
+        /**
+        * Copies the values of all elements of this property into contiguous memory. The property must be of type
+        * #rlogic::EPropertyType::Array with elements of primitive type matching T (same rules apply to template parameter T as in #get()).
+        *
+        * @param values pointer to memory for \p count values, values[i] receives value of element i, may be nullptr if \p count is 0
+        * @param count number of values, must be equal to #getChildCount()
+        * @return true if the values were copied, false if the property is not an array of T or \p count does not match.
+        */
+        template <typename T> bool getArray(T* values, size_t count) const;
+
+        /**
+        * Returns the update generation in which the value of this property last changed, i.e. the value of
+        * #rlogic::LogicEngine::getUpdateGeneration after the #rlogic::LogicEngine::update which consumed (in case of input)
+        * or produced (in case of output) the changed value. Setting a value which is equal to the current value is not a change.
+        * Returns 0 if the value did not change since the property was created or loaded, or if the property is not primitive.
+        *
+        * @return update generation of last change of the value
+        */
+        [[nodiscard]] RLOGIC_API uint64_t getChangeGeneration() const;
+
         /**
         * Checks if this property is linked to a property of another node.
         *
@@ -251,6 +285,14 @@ namespace rlogic
          * Internal implementation of #set
          */
         template <typename T> RLOGIC_API bool setInternal(T value);
+        /**
+         * Internal implementation of #setArray
+         */
+        template <typename T> RLOGIC_API bool setArrayInternal(const T* values, size_t count);
+        /**
+         * Internal implementation of #getArray
+         */
+        template <typename T> RLOGIC_API bool getArrayInternal(T* values, size_t count) const;
     };
 
     template <typename T> std::optional<T> Property::get() const
@@ -264,4 +306,16 @@ namespace rlogic
         static_assert(IsPrimitiveProperty<T>::value, "Call set<T> only with types which have a value! Read the docs of the method!");
         return setInternal<T>(value);
     }
+
+    template <typename T> bool Property::setArray(const T* values, size_t count)
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call setArray<T> only with types which have a value! Read the docs of the method!");
+        return setArrayInternal<T>(values, count);
+    }
+
+    template <typename T> bool Property::getArray(T* values, size_t count) const
+    {
+        static_assert(IsPrimitiveProperty<T>::value, "Call getArray<T> only with types which have a value! Read the docs of the method!");
+        return getArrayInternal<T>(values, count);
+    }
 }
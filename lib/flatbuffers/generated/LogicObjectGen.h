@@ -23,7 +23,8 @@ struct LogicObject FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
     VT_NAME = 4,
     VT_ID = 6,
     VT_USERIDHIGH = 8,
-    VT_USERIDLOW = 10
+    VT_USERIDLOW = 10,
+    VT_UPDATERATEDIVISOR = 12
   };
   const flatbuffers::String *name() const {
     return GetPointer<const flatbuffers::String *>(VT_NAME);
@@ -37,6 +38,9 @@ struct LogicObject FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   uint64_t userIdLow() const {
     return GetField<uint64_t>(VT_USERIDLOW, 0);
   }
+  uint32_t updateRateDivisor() const {
+    return GetField<uint32_t>(VT_UPDATERATEDIVISOR, 1);
+  }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyOffset(verifier, VT_NAME) &&
@@ -44,6 +48,7 @@ struct LogicObject FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<uint64_t>(verifier, VT_ID) &&
            VerifyField<uint64_t>(verifier, VT_USERIDHIGH) &&
            VerifyField<uint64_t>(verifier, VT_USERIDLOW) &&
+           VerifyField<uint32_t>(verifier, VT_UPDATERATEDIVISOR) &&
            verifier.EndTable();
   }
 };
@@ -64,6 +69,9 @@ struct LogicObjectBuilder {
   void add_userIdLow(uint64_t userIdLow) {
     fbb_.AddElement<uint64_t>(LogicObject::VT_USERIDLOW, userIdLow, 0);
   }
+  void add_updateRateDivisor(uint32_t updateRateDivisor) {
+    fbb_.AddElement<uint32_t>(LogicObject::VT_UPDATERATEDIVISOR, updateRateDivisor, 1);
+  }
   explicit LogicObjectBuilder(flatbuffers::FlatBufferBuilder &_fbb)
         : fbb_(_fbb) {
     start_ = fbb_.StartTable();
@@ -81,11 +89,13 @@ inline flatbuffers::Offset<LogicObject> CreateLogicObject(
     flatbuffers::Offset<flatbuffers::String> name = 0,
     uint64_t id = 0,
     uint64_t userIdHigh = 0,
-    uint64_t userIdLow = 0) {
+    uint64_t userIdLow = 0,
+    uint32_t updateRateDivisor = 1) {
   LogicObjectBuilder builder_(_fbb);
   builder_.add_userIdLow(userIdLow);
   builder_.add_userIdHigh(userIdHigh);
   builder_.add_id(id);
+  builder_.add_updateRateDivisor(updateRateDivisor);
   builder_.add_name(name);
   return builder_.Finish();
 }
@@ -100,14 +110,16 @@ inline flatbuffers::Offset<LogicObject> CreateLogicObjectDirect(
     const char *name = nullptr,
     uint64_t id = 0,
     uint64_t userIdHigh = 0,
-    uint64_t userIdLow = 0) {
+    uint64_t userIdLow = 0,
+    uint32_t updateRateDivisor = 1) {
   auto name__ = name ? _fbb.CreateString(name) : 0;
   return rlogic_serialization::CreateLogicObject(
       _fbb,
       name__,
       id,
       userIdHigh,
-      userIdLow);
+      userIdLow,
+      updateRateDivisor);
 }
 
 inline const flatbuffers::TypeTable *LogicObjectTypeTable() {
@@ -115,16 +127,18 @@ inline const flatbuffers::TypeTable *LogicObjectTypeTable() {
     { flatbuffers::ET_STRING, 0, -1 },
     { flatbuffers::ET_ULONG, 0, -1 },
     { flatbuffers::ET_ULONG, 0, -1 },
-    { flatbuffers::ET_ULONG, 0, -1 }
+    { flatbuffers::ET_ULONG, 0, -1 },
+    { flatbuffers::ET_UINT, 0, -1 }
   };
   static const char * const names[] = {
     "name",
     "id",
     "userIdHigh",
-    "userIdLow"
+    "userIdLow",
+    "updateRateDivisor"
   };
   static const flatbuffers::TypeTable tt = {
-    flatbuffers::ST_TABLE, 4, type_codes, nullptr, nullptr, names
+    flatbuffers::ST_TABLE, 5, type_codes, nullptr, nullptr, names
   };
   return &tt;
 }
@@ -48,7 +48,7 @@ namespace rlogic::internal
         SerializationMap& serializationMap,
         EFeatureLevel /*featureLevel*/)
     {
-        const auto fbLogicObject = LogicObjectImpl::Serialize(anchorPoint, builder);
+        const auto fbLogicObject = LogicObjectImpl::Serialize(anchorPoint, builder, anchorPoint.getUpdateRateDivisor());
         const auto fbOutputs = PropertyImpl::Serialize(*anchorPoint.getOutputs()->m_impl, builder, serializationMap);
         auto fbAnchorPoint = rlogic_serialization::CreateAnchorPoint(builder,
             fbLogicObject,
@@ -111,6 +111,7 @@ namespace rlogic::internal
 
         auto binding = std::make_unique<AnchorPointImpl>(*nodeBinding, *cameraBinding, name, id);
         binding->setUserId(userIdHigh, userIdLow);
+        binding->setUpdateRateDivisor(anchorPoint.base()->updateRateDivisor());
         binding->setRootProperties({}, std::make_unique<Property>(std::move(deserializedRootOutput)));
 
         return binding;
@@ -108,6 +108,11 @@ namespace rlogic::internal
         return m_channels;
     }
 
+    bool AnimationNodeImpl::canUpdateConcurrently() const
+    {
+        return true;
+    }
+
     std::optional<LogicNodeRuntimeError> AnimationNodeImpl::update()
     {
         // propagate data from properties if this animation node has channel data properties
@@ -332,7 +337,7 @@ namespace rlogic::internal
                 ));
         }
 
-        const auto logicObject = LogicObjectImpl::Serialize(animNode, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(animNode, builder, animNode.getUpdateRateDivisor());
         const auto inputPropertyObject = PropertyImpl::Serialize(*animNode.getInputs()->m_impl, builder, serializationMap);
         const auto ouputPropertyObject = PropertyImpl::Serialize(*animNode.getOutputs()->m_impl, builder, serializationMap);
         return rlogic_serialization::CreateAnimationNode(
@@ -423,6 +428,7 @@ namespace rlogic::internal
 
         auto deserialized = std::make_unique<AnimationNodeImpl>(std::move(channels), hasChannelDataProperties, name, id);
         deserialized->setUserId(userIdHigh, userIdLow);
+        deserialized->setUpdateRateDivisor(animNodeFB.base()->updateRateDivisor());
 
         if (!rootInProperty->getChild(EInputIdx_Progress) || rootInProperty->getChild(EInputIdx_Progress)->getName() != "progress" ||
             rootOutProperty->getChildCount() != deserialized->getChannels().size() + EOutputIdx_ChannelsBegin ||
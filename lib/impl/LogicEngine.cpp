@@ -109,6 +109,11 @@ namespace rlogic
         return m_impl->createLuaScript(source, *config.m_impl, scriptName);
     }
 
+    LuaScript* LogicEngine::createLuaScriptInstance(const LuaScript& prototype, std::string_view scriptName)
+    {
+        return m_impl->createLuaScriptInstance(prototype, scriptName);
+    }
+
     LuaInterface* LogicEngine::createLuaInterface(std::string_view source, std::string_view interfaceName, const LuaConfig& config)
     {
         return m_impl->createLuaInterface(source, *config.m_impl, interfaceName, true);
@@ -217,6 +222,47 @@ namespace rlogic
         return m_impl->update();
     }
 
+    bool LogicEngine::update(const std::vector<const Property*>& requiredOutputs)
+    {
+        return m_impl->update(requiredOutputs);
+    }
+
+    Property* LogicEngine::resolvePropertyPath(std::string_view path)
+    {
+        return m_impl->resolvePropertyPath(path);
+    }
+
+    bool LogicEngine::setOutputSnapshotProperties(const std::vector<const Property*>& properties)
+    {
+        return m_impl->setOutputSnapshotProperties(properties);
+    }
+
+    OutputSnapshot& LogicEngine::getOutputSnapshot()
+    {
+        return m_impl->getOutputSnapshot();
+    }
+
+    uint64_t LogicEngine::getUpdateGeneration() const
+    {
+        return m_impl->getUpdateGeneration();
+    }
+
+    std::vector<const Property*> LogicEngine::collectChangedProperties(uint64_t sinceGeneration) const
+    {
+        return m_impl->collectChangedProperties(sinceGeneration);
+    }
+
+    template <typename T>
+    bool LogicEngine::setPropertyValuesInternal(const std::vector<std::pair<Property*, T>>& values)
+    {
+        return m_impl->setPropertyValues(values);
+    }
+
+    bool LogicEngine::updateWithBudget(std::chrono::microseconds timeBudget, size_t maxExecutedNodes, bool& updateCompleted)
+    {
+        return m_impl->updateWithBudget(timeBudget, maxExecutedNodes, updateCompleted);
+    }
+
     void LogicEngine::enableUpdateReport(bool enable)
     {
         m_impl->enableUpdateReport(enable);
@@ -237,6 +283,51 @@ namespace rlogic
         m_impl->setStatisticsLogLevel(logLevel);
     }
 
+    void LogicEngine::setParallelUpdateWorkerCount(size_t workerCount)
+    {
+        m_impl->setParallelUpdateWorkerCount(workerCount);
+    }
+
+    bool LogicEngine::setLuaStateCount(size_t luaStateCount)
+    {
+        return m_impl->setLuaStateCount(luaStateCount);
+    }
+
+    void LogicEngine::enableAutomaticLuaGarbageCollection(bool enabled)
+    {
+        m_impl->enableAutomaticLuaGarbageCollection(enabled);
+    }
+
+    bool LogicEngine::setLuaGarbageCollectorParameters(uint32_t pausePercent, uint32_t stepMultiplierPercent)
+    {
+        return m_impl->setLuaGarbageCollectorParameters(pausePercent, stepMultiplierPercent);
+    }
+
+    bool LogicEngine::collectLuaGarbage(std::chrono::microseconds timeBudget)
+    {
+        return m_impl->collectLuaGarbage(timeBudget);
+    }
+
+    void LogicEngine::enableSharedLuaCompilationCache(bool enabled)
+    {
+        m_impl->enableSharedLuaCompilationCache(enabled);
+    }
+
+    void LogicEngine::ClearSharedLuaCompilationCache()
+    {
+        internal::LogicEngineImpl::ClearSharedLuaCompilationCache();
+    }
+
+    void LogicEngine::enableTransformChangeTracking(bool enabled)
+    {
+        m_impl->enableTransformChangeTracking(enabled);
+    }
+
+    void LogicEngine::invalidateRamsesTransforms()
+    {
+        m_impl->invalidateRamsesTransforms();
+    }
+
     bool LogicEngine::loadFromFile(std::string_view filename, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
     {
         return m_impl->loadFromFile(filename, ramsesScene, enableMemoryVerification);
@@ -355,6 +446,18 @@ namespace rlogic
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<vec4i>(const std::vector<vec4i>&, std::string_view);
     template RLOGIC_API DataArray* LogicEngine::createDataArrayInternal<std::vector<float>>(const std::vector<std::vector<float>>&, std::string_view);
 
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<float>(const std::vector<std::pair<Property*, float>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<vec2f>(const std::vector<std::pair<Property*, vec2f>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<vec3f>(const std::vector<std::pair<Property*, vec3f>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<vec4f>(const std::vector<std::pair<Property*, vec4f>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<int32_t>(const std::vector<std::pair<Property*, int32_t>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<int64_t>(const std::vector<std::pair<Property*, int64_t>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<vec2i>(const std::vector<std::pair<Property*, vec2i>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<vec3i>(const std::vector<std::pair<Property*, vec3i>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<vec4i>(const std::vector<std::pair<Property*, vec4i>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<std::string>(const std::vector<std::pair<Property*, std::string>>&);
+    template RLOGIC_API bool LogicEngine::setPropertyValuesInternal<bool>(const std::vector<std::pair<Property*, bool>>&);
+
     template RLOGIC_API size_t LogicEngine::getSerializedSizeInternal<LogicObject>() const;
     template RLOGIC_API size_t LogicEngine::getSerializedSizeInternal<LuaScript>() const;
     template RLOGIC_API size_t LogicEngine::getSerializedSizeInternal<LuaModule>() const;
@@ -23,8 +23,11 @@
 #include "ramses-logic/RamsesRenderGroupBindingElements.h"
 #include "ramses-logic/RamsesMeshNodeBinding.h"
 #include "ramses-logic/SkinBinding.h"
+#include "ramses-logic/Property.h"
 
 #include "impl/LogicNodeImpl.h"
+#include "impl/PropertyImpl.h"
+#include "impl/OutputSnapshotImpl.h"
 #include "impl/LoggerImpl.h"
 #include "impl/LuaScriptImpl.h"
 #include "impl/LuaModuleImpl.h"
@@ -32,13 +35,20 @@
 #include "impl/SaveFileConfigImpl.h"
 #include "impl/LogicEngineReportImpl.h"
 #include "impl/RamsesRenderGroupBindingElementsImpl.h"
+#include "impl/RamsesNodeBindingImpl.h"
+#include "impl/RamsesCameraBindingImpl.h"
+#include "impl/AnchorPointImpl.h"
+#include "impl/SkinBindingImpl.h"
 
 #include "internals/FileUtils.h"
 #include "internals/TypeUtils.h"
 #include "internals/RamsesObjectResolver.h"
 #include "internals/ApiObjects.h"
+#include "internals/LuaCompilationCache.h"
+#include "internals/PropertyPath.h"
 
 #include "ramses-client-api/RenderGroup.h"
+#include "ramses-client-api/Camera.h"
 #include "ramses-client-api/UniformInput.h"
 #include "ramses-client-api/Appearance.h"
 #include "ramses-client-api/Effect.h"
@@ -52,6 +62,10 @@
 #include <string>
 #include <fstream>
 #include <streambuf>
+#include <unordered_map>
+#include <algorithm>
+#include <functional>
+#include <limits>
 
 namespace
 {
@@ -63,6 +77,7 @@ namespace rlogic::internal
 {
     LogicEngineImpl::LogicEngineImpl(EFeatureLevel featureLevel)
         : m_apiObjects{ std::make_unique<ApiObjects>(featureLevel) }
+        , m_outputSnapshot{ std::make_unique<OutputSnapshot>(std::make_unique<OutputSnapshotImpl>()) }
         , m_featureLevel{ featureLevel }
     {
         if (std::find(AllFeatureLevels.cbegin(), AllFeatureLevels.cend(), m_featureLevel) == AllFeatureLevels.cend())
@@ -80,6 +95,12 @@ namespace rlogic::internal
         return m_apiObjects->createLuaScript(source, config, scriptName, m_errors);
     }
 
+    LuaScript* LogicEngineImpl::createLuaScriptInstance(const LuaScript& prototype, std::string_view scriptName)
+    {
+        m_errors.clear();
+        return m_apiObjects->createLuaScriptInstance(prototype, scriptName, m_errors);
+    }
+
     LuaInterface* LogicEngineImpl::createLuaInterface(std::string_view source, const LuaConfigImpl& config, std::string_view interfaceName, bool verifyModules)
     {
         m_errors.clear();
@@ -108,6 +129,7 @@ namespace rlogic::internal
     RamsesNodeBinding* LogicEngineImpl::createRamsesNodeBinding(ramses::Node& ramsesNode, ERotationType rotationType, std::string_view name)
     {
         m_errors.clear();
+        m_transformDependenciesValid = false;
         return m_apiObjects->createRamsesNodeBinding(ramsesNode, rotationType,  name);
     }
 
@@ -120,6 +142,7 @@ namespace rlogic::internal
     RamsesCameraBinding* LogicEngineImpl::createRamsesCameraBinding(ramses::Camera& ramsesCamera, std::string_view name)
     {
         m_errors.clear();
+        m_transformDependenciesValid = false;
         return m_apiObjects->createRamsesCameraBinding(ramsesCamera, false, name);
     }
 
@@ -132,6 +155,7 @@ namespace rlogic::internal
             return nullptr;
         }
 
+        m_transformDependenciesValid = false;
         return m_apiObjects->createRamsesCameraBinding(ramsesCamera, true, name);
     }
 
@@ -260,6 +284,7 @@ namespace rlogic::internal
         for (const auto j : joints)
             jointsAsImpls.push_back(&j->m_nodeBinding);
 
+        m_transformDependenciesValid = false;
         return m_apiObjects->createSkinBinding(std::move(jointsAsImpls), inverseBindMatrices, appearanceBinding.m_appearanceBinding, actualUniformInput, name);
     }
 
@@ -358,13 +383,25 @@ namespace rlogic::internal
             return nullptr;
         }
 
+        m_transformDependenciesValid = false;
         return m_apiObjects->createAnchorPoint(nodeBinding.m_nodeBinding, cameraBinding.m_cameraBinding, name);
     }
 
     bool LogicEngineImpl::destroy(LogicObject& object)
     {
         m_errors.clear();
-        return m_apiObjects->destroy(object, m_errors);
+        // dependency lists of bindings may refer to destroyed object, they are never used before rebuilt on next update
+        m_transformDependenciesValid = false;
+
+        // node is only compared by address after it was destroyed
+        const LogicNode* node = object.as<LogicNode>();
+        const LogicNodeImpl* nodeImpl = (node != nullptr ? &node->m_impl : nullptr);
+        if (!m_apiObjects->destroy(object, m_errors))
+            return false;
+
+        if (nodeImpl != nullptr)
+            m_outputSnapshot->m_impl->removePropertiesOf(nodeImpl);
+        return true;
     }
 
     bool LogicEngineImpl::isLinked(const LogicNode& logicNode) const
@@ -377,39 +414,187 @@ namespace rlogic::internal
         return m_featureLevel;
     }
 
-    size_t LogicEngineImpl::activateLinksRecursive(PropertyImpl& output)
+    size_t LogicEngineImpl::activateLinks(LogicNodeImpl& node)
     {
         size_t activatedLinks = 0u;
 
-        const auto childCount = output.getChildCount();
-        for (size_t i = 0; i < childCount; ++i)
+        for (const LinkPropagationEntry& link : node.getLinkPropagationTable())
         {
-            PropertyImpl& child = *output.getChild(i)->m_impl;
+            const bool valueChanged = link.target->setValueFrom(*link.source);
+            if (valueChanged || link.alwaysActivate)
+            {
+                link.targetNode->setDirty(true);
+                ++activatedLinks;
+            }
+        }
+
+        return activatedLinks;
+    }
+
+    bool LogicEngineImpl::update()
+    {
+        return updateInternal(nullptr, nullptr);
+    }
+
+    bool LogicEngineImpl::update(const std::vector<const Property*>& requiredOutputs)
+    {
+        m_errors.clear();
 
-            if (TypeUtils::CanHaveChildren(child.getType()))
+        NodeVector requiredNodes;
+        requiredNodes.reserve(requiredOutputs.size());
+        for (const Property* property : requiredOutputs)
+        {
+            if (property == nullptr)
             {
-                activatedLinks += activateLinksRecursive(child);
+                m_errors.add("Cannot update logic nodes required for a null property", nullptr, EErrorType::IllegalArgument);
+                return false;
             }
-            else
+
+            LogicNodeImpl& node = property->m_impl->getLogicNode();
+            if (!m_apiObjects->getLogicNodeDependencies().containsNode(node))
             {
-                const auto& outgoingLinks = child.getOutgoingLinks();
-                for (const auto& outLink : outgoingLinks)
-                {
-                    PropertyImpl* linkedProp = outLink.property;
-                    const bool valueChanged = linkedProp->setValue(child.getValue());
-                    if (valueChanged || linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
-                    {
-                        linkedProp->getLogicNode().setDirty(true);
-                        ++activatedLinks;
-                    }
-                }
+                m_errors.add(fmt::format("Cannot update logic nodes required for property '{}', LogicNode '{}' is not an instance of this LogicEngine", property->getName(), node.getName()),
+                    nullptr, EErrorType::IllegalArgument);
+                return false;
             }
+
+            requiredNodes.push_back(&node);
         }
 
-        return activatedLinks;
+        return updateInternal(nullptr, &requiredNodes);
     }
 
-    bool LogicEngineImpl::update()
+    template <typename T>
+    bool LogicEngineImpl::setPropertyValues(const std::vector<std::pair<Property*, T>>& values)
+    {
+        m_errors.clear();
+
+        // validate all values first so that either all or none of them are applied
+        const LogicNodeDependencies& logicNodeDependencies = m_apiObjects->getLogicNodeDependencies();
+        for (const auto& [property, value] : values)
+        {
+            if (property == nullptr)
+            {
+                m_errors.add("Cannot set value of a null property", nullptr, EErrorType::IllegalArgument);
+                return false;
+            }
+
+            LogicNodeImpl& node = property->m_impl->getLogicNode();
+            if (!logicNodeDependencies.containsNode(node))
+            {
+                m_errors.add(fmt::format("Cannot set value of property '{}', LogicNode '{}' is not an instance of this LogicEngine", property->getName(), node.getName()),
+                    nullptr, EErrorType::IllegalArgument);
+                return false;
+            }
+
+            const std::optional<std::string> error = property->m_impl->checkValueCanBeSet_PublicApi(value);
+            if (error)
+            {
+                m_errors.add(*error, m_apiObjects->getApiObject(node), EErrorType::IllegalArgument);
+                return false;
+            }
+        }
+
+        // values of one node are typically set together, mark such node dirty only once
+        const LogicNodeImpl* lastDirtyNode = nullptr;
+        for (const auto& [property, value] : values)
+        {
+            LogicNodeImpl& node = property->m_impl->getLogicNode();
+            if (property->m_impl->setCheckedValue_PublicApi(value) && &node != lastDirtyNode)
+            {
+                node.setDirty(true);
+                lastDirtyNode = &node;
+            }
+        }
+
+        return true;
+    }
+
+    Property* LogicEngineImpl::resolvePropertyPath(std::string_view path)
+    {
+        m_errors.clear();
+        return PropertyPath::Resolve(*m_apiObjects, path, m_errors);
+    }
+
+    bool LogicEngineImpl::setOutputSnapshotProperties(const std::vector<const Property*>& properties)
+    {
+        m_errors.clear();
+
+        std::vector<const PropertyImpl*> propertyImpls;
+        propertyImpls.reserve(properties.size());
+        for (const Property* property : properties)
+        {
+            if (property == nullptr)
+            {
+                m_errors.add("Cannot publish a null property in output snapshot", nullptr, EErrorType::IllegalArgument);
+                return false;
+            }
+
+            LogicNodeImpl& node = property->m_impl->getLogicNode();
+            if (!m_apiObjects->getLogicNodeDependencies().containsNode(node))
+            {
+                m_errors.add(fmt::format("Cannot publish property '{}' in output snapshot, LogicNode '{}' is not an instance of this LogicEngine", property->getName(), node.getName()),
+                    nullptr, EErrorType::IllegalArgument);
+                return false;
+            }
+
+            if (!TypeUtils::IsPrimitiveType(property->getType()))
+            {
+                m_errors.add(fmt::format("Cannot publish property '{}' in output snapshot, only properties of primitive type can be published", property->getName()),
+                    m_apiObjects->getApiObject(node), EErrorType::IllegalArgument);
+                return false;
+            }
+
+            propertyImpls.push_back(property->m_impl.get());
+        }
+
+        m_outputSnapshot->m_impl->setProperties(std::move(propertyImpls));
+        return true;
+    }
+
+    OutputSnapshot& LogicEngineImpl::getOutputSnapshot()
+    {
+        return *m_outputSnapshot;
+    }
+
+    uint64_t LogicEngineImpl::getUpdateGeneration() const
+    {
+        return m_apiObjects->getUpdateGeneration();
+    }
+
+    std::vector<const Property*> LogicEngineImpl::collectChangedProperties(uint64_t sinceGeneration) const
+    {
+        std::vector<const Property*> changedProperties;
+        for (const LogicObject* object : m_apiObjects->getApiObjectContainer<LogicObject>())
+        {
+            const LogicNode* node = object->as<LogicNode>();
+            if (node != nullptr)
+                node->m_impl.collectChangedProperties(sinceGeneration, changedProperties);
+        }
+        return changedProperties;
+    }
+
+    bool LogicEngineImpl::updateWithBudget(std::chrono::microseconds timeBudget, size_t maxExecutedNodes, bool& updateCompleted)
+    {
+        UpdateBudget budget;
+        const auto now = std::chrono::steady_clock::now();
+        // avoid overflow of time point for 'unlimited' time budget
+        const auto maxTimeBudget = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::time_point::max() - now);
+        budget.deadline = (timeBudget < maxTimeBudget ? now + timeBudget : std::chrono::steady_clock::time_point::max());
+        budget.maxExecutedNodes = maxExecutedNodes;
+
+        const bool success = updateInternal(&budget, nullptr);
+        updateCompleted = success && !budget.stoppedAtRank;
+
+        return success;
+    }
+
+    bool LogicEngineImpl::UpdateBudget::isExhausted() const
+    {
+        return executedNodes >= maxExecutedNodes || std::chrono::steady_clock::now() >= deadline;
+    }
+
+    bool LogicEngineImpl::updateInternal(UpdateBudget* budget, const NodeVector* requiredNodes)
     {
         m_errors.clear();
 
@@ -423,20 +608,72 @@ namespace rlogic::internal
             m_updateReport.sectionStarted(UpdateReport::ETimingSection::TopologySort);
         }
 
-        const std::optional<NodeVector>& sortedNodes = m_apiObjects->getLogicNodeDependencies().getTopologicallySortedNodes();
+        LogicNodeDependencies& nodeDependencies = m_apiObjects->getLogicNodeDependencies();
+        const std::optional<NodeVector>& sortedNodes = nodeDependencies.getTopologicallySortedNodes();
         if (!sortedNodes)
         {
             m_errors.add("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling update()!", nullptr, EErrorType::ContentStateError);
             return false;
         }
 
+        // continue interrupted update with budget unless ranks of nodes changed meanwhile, update without budget executes all remaining nodes anyway
+        std::optional<size_t> resumeRank;
+        if (budget && m_interruptedUpdate && m_interruptedUpdate->orderRevision == nodeDependencies.getTopologicalOrderRevision())
+            resumeRank = m_interruptedUpdate->nextRank;
+        // update of required nodes leaves other dirty nodes untouched, so interrupted update can still continue after it
+        if (!requiredNodes)
+            m_interruptedUpdate.reset();
+
         if (m_updateReportEnabled)
             m_updateReport.sectionFinished(UpdateReport::ETimingSection::TopologySort);
 
-        // force dirty all timer nodes, anchor points and skinbindings
-        setNodeToBeAlwaysUpdatedDirty();
+        if (m_transformChangeTrackingEnabled && !m_transformDependenciesValid)
+            updateTransformDependencies();
 
-        const bool success = updateNodes(*sortedNodes);
+        // force dirty all timer nodes (and anchor points and skinbindings unless their dependencies are tracked),
+        // continued update was already preceded by this
+        if (!resumeRank)
+            setNodeToBeAlwaysUpdatedDirty();
+
+        bool success = false;
+        if (requiredNodes)
+        {
+            success = updateNodesWithRanks(*sortedNodes, nodeDependencies.getUpstreamNodeRanks(*requiredNodes));
+            if (m_updateReportEnabled)
+                m_updateReport.nodesDeferred(nodeDependencies.getDirtyNodeWorklist().countMarked(0u));
+        }
+        else if (budget)
+        {
+            success = updateNodes(*sortedNodes, resumeRank.value_or(0u), budget);
+            if (success && budget->stoppedAtRank)
+                m_interruptedUpdate = InterruptedUpdate{ *budget->stoppedAtRank, nodeDependencies.getTopologicalOrderRevision() };
+        }
+        else
+        {
+            success = m_updateWorkerPool ?
+                updateNodesLevelWise(*sortedNodes, nodeDependencies.getTopologicalLevels()) :
+                updateNodes(*sortedNodes);
+        }
+
+        // every update consumes and produces values of its own generation, see LogicEngine::getUpdateGeneration
+        m_apiObjects->setUpdateGeneration(m_apiObjects->getUpdateGeneration() + 1u);
+
+        // update rates count only complete updates of whole logic, only their results are published
+        if (!requiredNodes && !(budget && budget->stoppedAtRank))
+        {
+            ++m_completedUpdateCount;
+            if (success)
+                m_outputSnapshot->m_impl->publish();
+        }
+
+        if (m_updateReportEnabled)
+        {
+            size_t luaMemoryUsage = 0u;
+            for (const auto& solState : m_apiObjects->getSolStates())
+                luaMemoryUsage += solState->getMemoryUsage();
+            m_updateReport.luaMemoryMeasured(luaMemoryUsage, m_luaGarbageCollectionTime);
+        }
+        m_luaGarbageCollectionTime = UpdateReport::ReportTimeUnits{ 0 };
 
         if (m_statisticsEnabled || m_updateReportEnabled)
         {
@@ -449,46 +686,323 @@ namespace rlogic::internal
         return success;
     }
 
-    bool LogicEngineImpl::updateNodes(const NodeVector& sortedNodes)
+    bool LogicEngineImpl::updateNodes(const NodeVector& sortedNodes, size_t firstRank, UpdateBudget* budget)
     {
-        for (LogicNodeImpl* nodeIter : sortedNodes)
+        // at least one node is executed with any budget, so that update always makes progress
+        const auto budgetExhausted = [budget]() {
+            return budget != nullptr && budget->executedNodes > 0u && budget->isExhausted();
+        };
+
+        if (!m_nodeDirtyMechanismEnabled)
+        {
+            for (size_t rank = firstRank; rank < sortedNodes.size(); ++rank)
+            {
+                LogicNodeImpl& node = *sortedNodes[rank];
+                if (budgetExhausted())
+                {
+                    budget->stoppedAtRank = rank;
+                    if (m_updateReportEnabled)
+                        m_updateReport.nodesDeferred(sortedNodes.size() - rank);
+                    return true;
+                }
+
+                if (!isUpdateDue(node))
+                {
+                    if (m_updateReportEnabled)
+                        m_updateReport.nodeSkippedExecution(node);
+                    continue;
+                }
+
+                if (m_updateReportEnabled && !node.isDirty())
+                    m_updateReport.nodeSkippedExecution(node);
+
+                if (!updateNode(node))
+                    return false;
+                if (budget)
+                    ++budget->executedNodes;
+            }
+
+            return true;
+        }
+
+        // Visit only nodes marked as dirty, in topological order. Link activation marks only nodes with higher
+        // rank than the executed node, except for weak links - those nodes are left marked for the next update.
+        // Update with budget can start at later rank, nodes with lower rank which are marked stay for the next update.
+        DirtyNodeWorklist& dirtyNodes = m_apiObjects->getLogicNodeDependencies().getDirtyNodeWorklist();
+        size_t nextUnvisitedRank = firstRank;
+        for (size_t rank = dirtyNodes.popNextMarked(firstRank); rank != DirtyNodeWorklist::InvalidRank; rank = dirtyNodes.popNextMarked(rank + 1u))
         {
-            LogicNodeImpl& node = *nodeIter;
+            if (m_updateReportEnabled)
+                reportSkippedNodes(sortedNodes, nextUnvisitedRank, rank);
+            nextUnvisitedRank = rank + 1u;
 
+            LogicNodeImpl& node = *sortedNodes[rank];
+            // node could have been marked and then set to not dirty
             if (!node.isDirty())
             {
                 if (m_updateReportEnabled)
                     m_updateReport.nodeSkippedExecution(node);
+                continue;
+            }
 
-                if(m_nodeDirtyMechanismEnabled)
-                    continue;
+            // node of lower update rate stays dirty until its next update is due
+            if (!isUpdateDue(node))
+            {
+                dirtyNodes.mark(rank);
+                if (m_updateReportEnabled)
+                    m_updateReport.nodeSkippedExecution(node);
+                continue;
             }
 
-            if (m_updateReportEnabled)
-                m_updateReport.nodeExecutionStarted(node);
-            if (m_statisticsEnabled)
-                m_statistics.nodeExecuted();
+            if (budgetExhausted())
+            {
+                // node stays dirty, keep it in worklist together with all following dirty nodes
+                dirtyNodes.mark(rank);
+                budget->stoppedAtRank = rank;
+                if (m_updateReportEnabled)
+                    m_updateReport.nodesDeferred(dirtyNodes.countMarked(rank));
+                return true;
+            }
 
-            const std::optional<LogicNodeRuntimeError> potentialError = node.update();
-            if (potentialError)
+            if (!updateNode(node))
             {
-                m_errors.add(potentialError->message, m_apiObjects->getApiObject(node), EErrorType::RuntimeError);
+                // node stays dirty, keep it in worklist
+                dirtyNodes.mark(rank);
                 return false;
             }
+            if (budget)
+                ++budget->executedNodes;
+        }
+
+        if (m_updateReportEnabled)
+            reportSkippedNodes(sortedNodes, nextUnvisitedRank, sortedNodes.size());
 
-            Property* outputs = node.getOutputs();
-            if (outputs != nullptr)
+        return true;
+    }
+
+    bool LogicEngineImpl::updateNodesWithRanks(const NodeVector& sortedNodes, const std::vector<size_t>& ranks)
+    {
+        // Ranks are ascending, so nodes set dirty by link activation are visited later in this loop if they are among given ranks.
+        DirtyNodeWorklist& dirtyNodes = m_apiObjects->getLogicNodeDependencies().getDirtyNodeWorklist();
+        for (const size_t rank : ranks)
+        {
+            LogicNodeImpl& node = *sortedNodes[rank];
+            if (!node.isDirty())
             {
-                const size_t activatedLinks = activateLinksRecursive(*outputs->m_impl);
+                if (m_updateReportEnabled)
+                    m_updateReport.nodeSkippedExecution(node);
 
-                if (m_statisticsEnabled || m_updateReportEnabled)
-                    m_updateReport.linksActivated(activatedLinks);
+                if (m_nodeDirtyMechanismEnabled)
+                    continue;
             }
 
+            if (!updateNode(node))
+                return false;
+            dirtyNodes.unmark(rank);
+        }
+
+        return true;
+    }
+
+    bool LogicEngineImpl::isUpdateDue(const LogicNodeImpl& node) const
+    {
+        return m_completedUpdateCount % node.getUpdateRateDivisor() == 0u;
+    }
+
+    bool LogicEngineImpl::updateNode(LogicNodeImpl& node)
+    {
+        if (m_updateReportEnabled)
+            m_updateReport.nodeExecutionStarted(node);
+        if (m_statisticsEnabled)
+            m_statistics.nodeExecuted();
+
+        const std::optional<LogicNodeRuntimeError> potentialError = node.update();
+        if (potentialError)
+        {
+            m_errors.add(potentialError->message, m_apiObjects->getApiObject(node), EErrorType::RuntimeError);
+            return false;
+        }
+
+        const size_t activatedLinks = activateLinks(node);
+        if (m_statisticsEnabled || m_updateReportEnabled)
+            m_updateReport.linksActivated(activatedLinks);
+
+        if (m_updateReportEnabled)
+            m_updateReport.nodeExecutionFinished();
+
+        node.setDirty(false);
+
+        return true;
+    }
+
+    void LogicEngineImpl::reportSkippedNodes(const NodeVector& sortedNodes, size_t fromRank, size_t toRank)
+    {
+        for (size_t rank = fromRank; rank < toRank; ++rank)
+            m_updateReport.nodeSkippedExecution(*sortedNodes[rank]);
+    }
+
+    bool LogicEngineImpl::updateNodesLevelWise(const NodeVector& sortedNodes, const std::vector<size_t>& levels)
+    {
+        const auto addToLevel = [this, &levels](size_t rank) {
+            const size_t level = levels[rank];
+            if (level >= m_levelRanks.size())
+                m_levelRanks.resize(level + 1u);
+            if (m_levelRanks[level].empty())
+                m_pendingLevels.push(level);
+            m_levelRanks[level].push_back(rank);
+        };
+
+        // Visit only nodes marked as dirty, same as serial update. They stay marked until they are executed (and reset to not dirty),
+        // so only ranks which get newly marked during this update are logged - those are nodes set dirty by link activation or
+        // by bindings. They are executed in their level if it was not processed yet, otherwise they stay marked for the next update
+        // (weak links). With dirty mechanism disabled all nodes are visited.
+        DirtyNodeWorklist& dirtyNodes = m_apiObjects->getLogicNodeDependencies().getDirtyNodeWorklist();
+        if (m_nodeDirtyMechanismEnabled)
+        {
+            for (size_t rank = dirtyNodes.findNextMarked(0u); rank != DirtyNodeWorklist::InvalidRank; rank = dirtyNodes.findNextMarked(rank + 1u))
+                addToLevel(rank);
+            dirtyNodes.setNewMarksLog(&m_newlyMarkedRanks);
+        }
+        else
+        {
+            for (size_t rank = 0u; rank < sortedNodes.size(); ++rank)
+                addToLevel(rank);
+        }
+        m_executedRanks.clear();
+
+        bool success = true;
+        while (!m_pendingLevels.empty())
+        {
+            const size_t level = m_pendingLevels.top();
+            m_pendingLevels.pop();
+
+            std::vector<size_t>& levelRanks = m_levelRanks[level];
+            if (success)
+            {
+                // ranks are collected in arbitrary order, execute them in sorted order same as serial update would
+                std::sort(levelRanks.begin(), levelRanks.end());
+                levelRanks.erase(std::unique(levelRanks.begin(), levelRanks.end()), levelRanks.end());
+                // nodes failing to execute stay dirty, remaining levels are only cleared
+                success = updateLevel(sortedNodes, levelRanks);
+            }
+            levelRanks.clear();
+
+            for (const size_t rank : m_newlyMarkedRanks)
+            {
+                if (levels[rank] > level)
+                    addToLevel(rank);
+            }
+            m_newlyMarkedRanks.clear();
+        }
+        dirtyNodes.setNewMarksLog(nullptr);
+
+        if (success && m_updateReportEnabled)
+        {
+            std::sort(m_executedRanks.begin(), m_executedRanks.end());
+            size_t nextUnvisitedRank = 0u;
+            for (const size_t rank : m_executedRanks)
+            {
+                reportSkippedNodes(sortedNodes, nextUnvisitedRank, rank);
+                nextUnvisitedRank = rank + 1u;
+            }
+            reportSkippedNodes(sortedNodes, nextUnvisitedRank, sortedNodes.size());
+        }
+
+        return success;
+    }
+
+    bool LogicEngineImpl::updateLevel(const NodeVector& sortedNodes, const std::vector<size_t>& levelRanks)
+    {
+        const bool measureNodes = m_updateReportEnabled;
+        const auto executeNode = [measureNodes](NodeExecution& execution) {
+            const auto startTime = measureNodes ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{};
+            execution.error = execution.node->update();
+            if (measureNodes)
+                execution.executionTime = std::chrono::duration_cast<UpdateReport::ReportTimeUnits>(std::chrono::steady_clock::now() - startTime);
+        };
+
+        m_levelExecutions.clear();
+        m_levelConcurrentExecutions.clear();
+
+        for (const size_t rank : levelRanks)
+        {
+            LogicNodeImpl* node = sortedNodes[rank];
+            if (!node->isDirty())
+            {
+                // node could have been marked and then set to not dirty
+                if (m_nodeDirtyMechanismEnabled)
+                {
+                    m_apiObjects->getLogicNodeDependencies().getDirtyNodeWorklist().unmark(rank);
+                    continue;
+                }
+                // executed anyway, same as serial update
+                if (m_updateReportEnabled && isUpdateDue(*node))
+                    m_updateReport.nodeSkippedExecution(*node);
+            }
+
+            // node of lower update rate stays dirty (and marked) until its next update is due
+            if (!isUpdateDue(*node))
+                continue;
+
+            if (node->canUpdateConcurrently())
+                m_levelConcurrentExecutions.push_back(m_levelExecutions.size());
+            m_levelExecutions.push_back({ rank, node, std::nullopt, UpdateReport::ReportTimeUnits{ 0 } });
+        }
+
+        // Nodes of the same concurrent update group (e.g. scripts sharing a Lua state) form one task and are executed one after
+        // another in sorted order, every other concurrent node forms a task of its own
+        const auto getGroup = [this](size_t concurrentIdx) { return m_levelExecutions[m_levelConcurrentExecutions[concurrentIdx]].node->getConcurrentUpdateGroup(); };
+        std::stable_sort(m_levelConcurrentExecutions.begin(), m_levelConcurrentExecutions.end(), [this](size_t lhs, size_t rhs) {
+            return std::less<const void*>()(m_levelExecutions[lhs].node->getConcurrentUpdateGroup(), m_levelExecutions[rhs].node->getConcurrentUpdateGroup());
+        });
+        m_levelConcurrentTaskBegins.clear();
+        for (size_t i = 0u; i < m_levelConcurrentExecutions.size(); ++i)
+        {
+            if (i == 0u || getGroup(i) == nullptr || getGroup(i) != getGroup(i - 1u))
+                m_levelConcurrentTaskBegins.push_back(i);
+        }
+        const size_t taskCount = m_levelConcurrentTaskBegins.size();
+        m_levelConcurrentTaskBegins.push_back(m_levelConcurrentExecutions.size());
+
+        // Nodes within one level don't depend on each other, so the ones not touching shared Lua state or Ramses can run on workers.
+        // All other nodes are executed on this thread once the workers are done.
+        m_updateWorkerPool->execute(taskCount, [this, &executeNode](size_t idx) {
+            for (size_t i = m_levelConcurrentTaskBegins[idx]; i < m_levelConcurrentTaskBegins[idx + 1u]; ++i)
+                executeNode(m_levelExecutions[m_levelConcurrentExecutions[i]]);
+        });
+        for (NodeExecution& execution : m_levelExecutions)
+        {
+            if (!execution.node->canUpdateConcurrently())
+                executeNode(execution);
+        }
+
+        // Report results and propagate outputs in sorted order, same as serial update would
+        for (const NodeExecution& execution : m_levelExecutions)
+        {
+            if (execution.error)
+            {
+                m_errors.add(execution.error->message, m_apiObjects->getApiObject(*execution.node), EErrorType::RuntimeError);
+                return false;
+            }
+        }
+
+        // Reset dirtiness before propagating, weak links between nodes of this level must be able to set them dirty again
+        for (const NodeExecution& execution : m_levelExecutions)
+            execution.node->setDirty(false);
+
+        for (const NodeExecution& execution : m_levelExecutions)
+        {
             if (m_updateReportEnabled)
-                m_updateReport.nodeExecutionFinished();
+            {
+                m_updateReport.nodeExecuted(*execution.node, execution.executionTime);
+                m_executedRanks.push_back(execution.rank);
+            }
+            if (m_statisticsEnabled)
+                m_statistics.nodeExecuted();
 
-            node.setDirty(false);
+            const size_t activatedLinks = activateLinks(*execution.node);
+            if (m_statisticsEnabled || m_updateReportEnabled)
+                m_updateReport.linksActivated(activatedLinks);
         }
 
         return true;
@@ -499,6 +1013,10 @@ namespace rlogic::internal
         // force timer nodes dirty so they can update their ticker
         for (TimerNode* timerNode : m_apiObjects->getApiObjectContainer<TimerNode>())
             timerNode->m_impl.setDirty(true);
+
+        if (m_transformChangeTrackingEnabled)
+            return;
+
         // force anchor points dirty because they depend on set of ramses states which cannot be monitored
         for (AnchorPoint* anchorPoint : m_apiObjects->getApiObjectContainer<AnchorPoint>())
             anchorPoint->m_impl.setDirty(true);
@@ -507,6 +1025,54 @@ namespace rlogic::internal
             skinBinding->m_impl.setDirty(true);
     }
 
+    void LogicEngineImpl::updateTransformDependencies()
+    {
+        clearTransformDependencies();
+
+        std::unordered_map<const ramses::Node*, std::vector<RamsesNodeBindingImpl*>> bindingsByRamsesNode;
+        for (RamsesNodeBinding* nodeBinding : m_apiObjects->getApiObjectContainer<RamsesNodeBinding>())
+            bindingsByRamsesNode[&nodeBinding->m_nodeBinding.getRamsesNode()].push_back(&nodeBinding->m_nodeBinding);
+
+        // world transformation of a ramses node is affected by all bindings bound to the node or to any of its parents
+        const auto addTransformDependencies = [&bindingsByRamsesNode](ramses::Node& ramsesNode, LogicNodeImpl& dependentNode) {
+            for (ramses::Node* node = &ramsesNode; node != nullptr; node = node->getParent())
+            {
+                const auto it = bindingsByRamsesNode.find(node);
+                if (it == bindingsByRamsesNode.cend())
+                    continue;
+                for (RamsesNodeBindingImpl* binding : it->second)
+                    binding->addRamsesStateDependent(dependentNode);
+            }
+        };
+
+        for (AnchorPoint* anchorPoint : m_apiObjects->getApiObjectContainer<AnchorPoint>())
+        {
+            AnchorPointImpl& anchorPointImpl = anchorPoint->m_anchorPointImpl;
+            addTransformDependencies(anchorPointImpl.getRamsesNodeBinding().getRamsesNode(), anchorPointImpl);
+            addTransformDependencies(anchorPointImpl.getRamsesCameraBinding().getRamsesCamera(), anchorPointImpl);
+            anchorPointImpl.getRamsesCameraBinding().addRamsesStateDependent(anchorPointImpl);
+            anchorPointImpl.setDirty(true);
+        }
+
+        for (SkinBinding* skinBinding : m_apiObjects->getApiObjectContainer<SkinBinding>())
+        {
+            SkinBindingImpl& skinBindingImpl = skinBinding->m_skinBinding;
+            for (const RamsesNodeBindingImpl* joint : skinBindingImpl.getJoints())
+                addTransformDependencies(joint->getRamsesNode(), skinBindingImpl);
+            skinBindingImpl.setDirty(true);
+        }
+
+        m_transformDependenciesValid = true;
+    }
+
+    void LogicEngineImpl::clearTransformDependencies()
+    {
+        for (RamsesNodeBinding* nodeBinding : m_apiObjects->getApiObjectContainer<RamsesNodeBinding>())
+            nodeBinding->m_nodeBinding.clearRamsesStateDependents();
+        for (RamsesCameraBinding* cameraBinding : m_apiObjects->getApiObjectContainer<RamsesCameraBinding>())
+            cameraBinding->m_cameraBinding.clearRamsesStateDependents();
+    }
+
     const std::vector<ErrorData>& LogicEngineImpl::getErrors() const
     {
         return m_errors.getErrors();
@@ -701,15 +1267,21 @@ namespace rlogic::internal
         if (scene != nullptr)
             ramsesResolver = std::make_unique<RamsesObjectResolver>(m_errors, *scene);
 
-        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(*logicEngine->apiObjects(), ramsesResolver.get(), dataSourceDescription, m_errors, m_featureLevel);
+        std::unique_ptr<ApiObjects> deserializedObjects = ApiObjects::Deserialize(*logicEngine->apiObjects(), ramsesResolver.get(), dataSourceDescription, m_errors, m_featureLevel,
+            m_apiObjects->getLuaStateCount(), m_apiObjects->isSharedCompilationCacheEnabled());
 
         if (!deserializedObjects)
         {
             return false;
         }
 
-        // No errors -> move data into member
+        // No errors -> move data into member, generation continues so that generations queried before loading stay comparable
+        deserializedObjects->setUpdateGeneration(m_apiObjects->getUpdateGeneration());
         m_apiObjects = std::move(deserializedObjects);
+        applyLuaGarbageCollectionSettings();
+        m_transformDependenciesValid = false;
+        // snapshot may be read concurrently, invalidate it through the regular lock-free publishing
+        m_outputSnapshot->m_impl->clearProperties();
 
         return true;
     }
@@ -922,6 +1494,125 @@ namespace rlogic::internal
         m_statistics.setLogLevel(logLevel);
     }
 
+    void LogicEngineImpl::setParallelUpdateWorkerCount(size_t workerCount)
+    {
+        if (workerCount == 0u)
+        {
+            m_updateWorkerPool.reset();
+        }
+        else if (!m_updateWorkerPool || m_updateWorkerPool->getWorkerCount() != workerCount)
+        {
+            m_updateWorkerPool.reset();
+            m_updateWorkerPool = std::make_unique<UpdateWorkerPool>(workerCount);
+        }
+    }
+
+    bool LogicEngineImpl::setLuaStateCount(size_t luaStateCount)
+    {
+        m_errors.clear();
+
+        if (luaStateCount == 0u)
+        {
+            m_errors.add("Failed to set Lua state count: at least one Lua state is required!", nullptr, EErrorType::IllegalArgument);
+            return false;
+        }
+
+        if (!m_apiObjects->getApiObjectContainer<LuaScript>().empty() ||
+            !m_apiObjects->getApiObjectContainer<LuaModule>().empty() ||
+            !m_apiObjects->getApiObjectContainer<LuaInterface>().empty())
+        {
+            m_errors.add("Failed to set Lua state count: it can only be changed while there are no Lua scripts, modules and interfaces!", nullptr, EErrorType::ContentStateError);
+            return false;
+        }
+
+        m_apiObjects->setLuaStateCount(luaStateCount);
+        applyLuaGarbageCollectionSettings();
+        return true;
+    }
+
+    void LogicEngineImpl::enableAutomaticLuaGarbageCollection(bool enabled)
+    {
+        m_luaAutomaticGarbageCollection = enabled;
+        applyLuaGarbageCollectionSettings();
+    }
+
+    bool LogicEngineImpl::setLuaGarbageCollectorParameters(uint32_t pausePercent, uint32_t stepMultiplierPercent)
+    {
+        m_errors.clear();
+
+        if (stepMultiplierPercent < 100u || pausePercent > static_cast<uint32_t>(std::numeric_limits<int>::max()) || stepMultiplierPercent > static_cast<uint32_t>(std::numeric_limits<int>::max()))
+        {
+            m_errors.add(fmt::format("Invalid Lua garbage collector parameters (pause {}%, step multiplier {}%), step multiplier must be at least 100%!", pausePercent, stepMultiplierPercent),
+                nullptr, EErrorType::IllegalArgument);
+            return false;
+        }
+
+        m_luaGarbageCollectorPause = static_cast<int>(pausePercent);
+        m_luaGarbageCollectorStepMultiplier = static_cast<int>(stepMultiplierPercent);
+        applyLuaGarbageCollectionSettings();
+        return true;
+    }
+
+    bool LogicEngineImpl::collectLuaGarbage(std::chrono::microseconds timeBudget)
+    {
+        const auto startTime = std::chrono::steady_clock::now();
+        const auto deadline = startTime + timeBudget;
+
+        // steps are interleaved between Lua states so that all of them make progress within the budget
+        const auto& solStates = m_apiObjects->getSolStates();
+        std::vector<bool> cycleFinished(solStates.size(), false);
+        size_t finishedCount = 0u;
+        do
+        {
+            for (size_t i = 0u; i < solStates.size(); ++i)
+            {
+                if (!cycleFinished[i] && solStates[i]->stepGarbageCollection())
+                {
+                    cycleFinished[i] = true;
+                    ++finishedCount;
+                }
+            }
+        } while (finishedCount < solStates.size() && std::chrono::steady_clock::now() < deadline);
+
+        m_luaGarbageCollectionTime += std::chrono::duration_cast<UpdateReport::ReportTimeUnits>(std::chrono::steady_clock::now() - startTime);
+        return finishedCount == solStates.size();
+    }
+
+    void LogicEngineImpl::enableSharedLuaCompilationCache(bool enabled)
+    {
+        m_apiObjects->enableSharedCompilationCache(enabled);
+    }
+
+    void LogicEngineImpl::ClearSharedLuaCompilationCache()
+    {
+        LuaCompilationCache::Get().clear();
+    }
+
+    void LogicEngineImpl::applyLuaGarbageCollectionSettings()
+    {
+        for (const auto& solState : m_apiObjects->getSolStates())
+        {
+            solState->setGarbageCollectorParameters(m_luaGarbageCollectorPause, m_luaGarbageCollectorStepMultiplier);
+            solState->setAutomaticGarbageCollection(m_luaAutomaticGarbageCollection);
+        }
+    }
+
+    void LogicEngineImpl::enableTransformChangeTracking(bool enabled)
+    {
+        if (enabled == m_transformChangeTrackingEnabled)
+            return;
+
+        m_transformChangeTrackingEnabled = enabled;
+        m_transformDependenciesValid = false;
+        if (!enabled)
+            clearTransformDependencies();
+    }
+
+    void LogicEngineImpl::invalidateRamsesTransforms()
+    {
+        m_transformDependenciesValid = false;
+    }
+
     size_t LogicEngineImpl::getTotalSerializedSize() const
     {
         return m_apiObjects->getTotalSerializedSize();
@@ -936,4 +1627,16 @@ namespace rlogic::internal
     template DataArray* LogicEngineImpl::createDataArray<vec3i>(const std::vector<vec3i>&, std::string_view name);
     template DataArray* LogicEngineImpl::createDataArray<vec4i>(const std::vector<vec4i>&, std::string_view name);
     template DataArray* LogicEngineImpl::createDataArray<std::vector<float>>(const std::vector<std::vector<float>>&, std::string_view name);
+
+    template bool LogicEngineImpl::setPropertyValues<float>(const std::vector<std::pair<Property*, float>>&);
+    template bool LogicEngineImpl::setPropertyValues<vec2f>(const std::vector<std::pair<Property*, vec2f>>&);
+    template bool LogicEngineImpl::setPropertyValues<vec3f>(const std::vector<std::pair<Property*, vec3f>>&);
+    template bool LogicEngineImpl::setPropertyValues<vec4f>(const std::vector<std::pair<Property*, vec4f>>&);
+    template bool LogicEngineImpl::setPropertyValues<int32_t>(const std::vector<std::pair<Property*, int32_t>>&);
+    template bool LogicEngineImpl::setPropertyValues<int64_t>(const std::vector<std::pair<Property*, int64_t>>&);
+    template bool LogicEngineImpl::setPropertyValues<vec2i>(const std::vector<std::pair<Property*, vec2i>>&);
+    template bool LogicEngineImpl::setPropertyValues<vec3i>(const std::vector<std::pair<Property*, vec3i>>&);
+    template bool LogicEngineImpl::setPropertyValues<vec4i>(const std::vector<std::pair<Property*, vec4i>>&);
+    template bool LogicEngineImpl::setPropertyValues<std::string>(const std::vector<std::pair<Property*, std::string>>&);
+    template bool LogicEngineImpl::setPropertyValues<bool>(const std::vector<std::pair<Property*, bool>>&);
 }
@@ -12,18 +12,23 @@
 #include "ramses-logic/ERotationType.h"
 #include "ramses-logic/AnimationTypes.h"
 #include "ramses-logic/LogicEngineReport.h"
+#include "ramses-logic/OutputSnapshot.h"
 #include "ramses-logic/DataTypes.h"
+#include "impl/LogicNodeImpl.h"
 #include "internals/ApiObjects.h"
 #include "internals/LogicNodeDependencies.h"
 #include "internals/ErrorReporting.h"
 #include "internals/ValidationResults.h"
 #include "internals/UpdateReport.h"
 #include "internals/LogicNodeUpdateStatistics.h"
+#include "internals/UpdateWorkerPool.h"
 
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
 
 #include <memory>
 #include <vector>
+#include <queue>
+#include <functional>
 #include <string>
 #include <string_view>
 
@@ -93,6 +98,7 @@ namespace rlogic::internal
 
         // Public API
         LuaScript* createLuaScript(std::string_view source, const LuaConfigImpl& config, std::string_view scriptName);
+        LuaScript* createLuaScriptInstance(const LuaScript& prototype, std::string_view scriptName);
         LuaInterface* createLuaInterface(std::string_view source, const LuaConfigImpl& config, std::string_view interfaceName, bool verifyModules);
         LuaModule* createLuaModule(std::string_view source, const LuaConfigImpl& config, std::string_view moduleName);
         bool extractLuaDependencies(std::string_view source, const std::function<void(const std::string&)>& callbackFunc);
@@ -118,6 +124,16 @@ namespace rlogic::internal
         bool destroy(LogicObject& object);
 
         bool update();
+        bool update(const std::vector<const Property*>& requiredOutputs);
+        template <typename T>
+        bool setPropertyValues(const std::vector<std::pair<Property*, T>>& values);
+
+        [[nodiscard]] Property* resolvePropertyPath(std::string_view path);
+        bool setOutputSnapshotProperties(const std::vector<const Property*>& properties);
+        [[nodiscard]] OutputSnapshot& getOutputSnapshot();
+        [[nodiscard]] uint64_t getUpdateGeneration() const;
+        [[nodiscard]] std::vector<const Property*> collectChangedProperties(uint64_t sinceGeneration) const;
+        bool updateWithBudget(std::chrono::microseconds timeBudget, size_t maxExecutedNodes, bool& updateCompleted);
 
         [[nodiscard]] const std::vector<ErrorData>& getErrors() const;
         const std::vector<WarningData>& validate() const;
@@ -148,20 +164,52 @@ namespace rlogic::internal
         void setStatisticsLoggingRate(size_t loggingRate);
         void setStatisticsLogLevel(ELogMessageType logLevel);
 
+        void setParallelUpdateWorkerCount(size_t workerCount);
+        bool setLuaStateCount(size_t luaStateCount);
+        void enableAutomaticLuaGarbageCollection(bool enabled);
+        bool setLuaGarbageCollectorParameters(uint32_t pausePercent, uint32_t stepMultiplierPercent);
+        bool collectLuaGarbage(std::chrono::microseconds timeBudget);
+        void enableSharedLuaCompilationCache(bool enabled);
+        static void ClearSharedLuaCompilationCache();
+
+        void enableTransformChangeTracking(bool enabled);
+        void invalidateRamsesTransforms();
+
         [[nodiscard]] size_t getTotalSerializedSize() const;
 
         template<typename T>
         [[nodiscard]] size_t getSerializedSize() const;
 
     private:
-        size_t activateLinksRecursive(PropertyImpl& output);
+        // Limits node executions in update, stoppedAtRank is set if the budget was exhausted before all dirty nodes were executed
+        struct UpdateBudget
+        {
+            std::chrono::steady_clock::time_point deadline;
+            size_t maxExecutedNodes = 0u;
+            size_t executedNodes = 0u;
+            std::optional<size_t> stoppedAtRank;
+
+            [[nodiscard]] bool isExhausted() const;
+        };
+
+        [[nodiscard]] bool updateInternal(UpdateBudget* budget, const NodeVector* requiredNodes);
+        size_t activateLinks(LogicNodeImpl& node);
         void setNodeToBeAlwaysUpdatedDirty();
+        void updateTransformDependencies();
+        void clearTransformDependencies();
+        void applyLuaGarbageCollectionSettings();
 
         static bool CheckRamsesVersionFromFile(const rlogic_serialization::Version& ramsesVersion);
 
         static void LogAssetMetadata(const rlogic_serialization::Metadata& assetMetadata);
 
-        [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        [[nodiscard]] bool updateNodes(const NodeVector& sortedNodes, size_t firstRank = 0u, UpdateBudget* budget = nullptr);
+        [[nodiscard]] bool updateNodesWithRanks(const NodeVector& sortedNodes, const std::vector<size_t>& ranks);
+        [[nodiscard]] bool updateNode(LogicNodeImpl& node);
+        [[nodiscard]] bool isUpdateDue(const LogicNodeImpl& node) const;
+        void reportSkippedNodes(const NodeVector& sortedNodes, size_t fromRank, size_t toRank);
+        [[nodiscard]] bool updateNodesLevelWise(const NodeVector& sortedNodes, const std::vector<size_t>& levels);
+        [[nodiscard]] bool updateLevel(const NodeVector& sortedNodes, const std::vector<size_t>& levelRanks);
 
         [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription);
         [[nodiscard]] bool checkFileIdentifierBytes(const std::string& dataSourceDescription, const std::string& fileIdBytes);
@@ -177,6 +225,51 @@ namespace rlogic::internal
         UpdateReport m_updateReport;
         LogicNodeUpdateStatistics m_statistics;
 
+        // level-wise parallel update, disabled if no pool
+        struct NodeExecution
+        {
+            size_t rank = 0u;
+            LogicNodeImpl* node = nullptr;
+            std::optional<LogicNodeRuntimeError> error;
+            UpdateReport::ReportTimeUnits executionTime {0};
+        };
+        std::unique_ptr<UpdateWorkerPool> m_updateWorkerPool;
+        std::vector<NodeExecution> m_levelExecutions;
+        std::vector<size_t> m_levelConcurrentExecutions;
+        // start of each task in m_levelConcurrentExecutions, followed by end of last task
+        std::vector<size_t> m_levelConcurrentTaskBegins;
+        // ranks of dirty nodes to be executed per level, and levels having any (lowest level on top)
+        std::vector<std::vector<size_t>> m_levelRanks;
+        std::priority_queue<size_t, std::vector<size_t>, std::greater<>> m_pendingLevels;
+        std::vector<size_t> m_newlyMarkedRanks;
+        std::vector<size_t> m_executedRanks;
+
+        // Lua garbage collection settings applied to all Lua states, defaults match Lua defaults
+        bool m_luaAutomaticGarbageCollection = true;
+        int m_luaGarbageCollectorPause = 200;
+        int m_luaGarbageCollectorStepMultiplier = 200;
+        // time spent in collectLuaGarbage since last update, reported with next update
+        UpdateReport::ReportTimeUnits m_luaGarbageCollectionTime{ 0 };
+
+        // anchor points and skin bindings are only updated when a binding modified ramses transformations they depend on,
+        // dependencies are collected from ramses scene hierarchy lazily on next update after being invalidated
+        bool m_transformChangeTrackingEnabled = false;
+        bool m_transformDependenciesValid = false;
+
+        // position where update with budget stopped, valid only as long as topological order does not change
+        struct InterruptedUpdate
+        {
+            size_t nextRank = 0u;
+            uint64_t orderRevision = 0u;
+        };
+        std::optional<InterruptedUpdate> m_interruptedUpdate;
+
+        // nodes with update rate divisor N are executed only in updates whose count is multiple of N
+        uint64_t m_completedUpdateCount = 0u;
+
+        // values of selected properties published after each complete update, for reading from other threads
+        std::unique_ptr<OutputSnapshot> m_outputSnapshot;
+
         EFeatureLevel m_featureLevel;
     };
 
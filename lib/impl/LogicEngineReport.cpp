@@ -50,4 +50,19 @@ namespace rlogic
         return m_impl->getTotalLinkActivations();
     }
 
+    size_t LogicEngineReport::getDeferredNodeCount() const
+    {
+        return m_impl->getDeferredNodeCount();
+    }
+
+    size_t LogicEngineReport::getLuaMemoryUsage() const
+    {
+        return m_impl->getLuaMemoryUsage();
+    }
+
+    std::chrono::microseconds LogicEngineReport::getLuaGarbageCollectionTime() const
+    {
+        return m_impl->getLuaGarbageCollectionTime();
+    }
+
 }
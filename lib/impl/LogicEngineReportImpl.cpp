@@ -17,6 +17,9 @@ namespace rlogic::internal
         : m_totalUpdateExecutionTime{ reportData.getSectionExecutionTime(UpdateReport::ETimingSection::TotalUpdate) }
         , m_topologySortExecutionTime{ reportData.getSectionExecutionTime(UpdateReport::ETimingSection::TopologySort) }
         , m_activatedLinks{ reportData.getLinkActivations() }
+        , m_deferredNodes{ reportData.getDeferredNodeCount() }
+        , m_luaMemoryUsage{ reportData.getLuaMemoryUsage() }
+        , m_luaGarbageCollectionTime{ reportData.getLuaGarbageCollectionTime() }
     {
         m_nodesExecuted.reserve(reportData.getNodesExecuted().size());
         for (const auto& n : reportData.getNodesExecuted())
@@ -52,4 +55,19 @@ namespace rlogic::internal
         return m_activatedLinks;
     }
 
+    size_t LogicEngineReportImpl::getDeferredNodeCount() const
+    {
+        return m_deferredNodes;
+    }
+
+    size_t LogicEngineReportImpl::getLuaMemoryUsage() const
+    {
+        return m_luaMemoryUsage;
+    }
+
+    std::chrono::microseconds LogicEngineReportImpl::getLuaGarbageCollectionTime() const
+    {
+        return m_luaGarbageCollectionTime;
+    }
+
 }
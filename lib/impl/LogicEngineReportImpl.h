@@ -29,6 +29,9 @@ namespace rlogic::internal
         [[nodiscard]] std::chrono::microseconds getTopologySortExecutionTime() const;
         [[nodiscard]] std::chrono::microseconds getTotalUpdateExecutionTime() const;
         [[nodiscard]] size_t getTotalLinkActivations() const;
+        [[nodiscard]] size_t getDeferredNodeCount() const;
+        [[nodiscard]] size_t getLuaMemoryUsage() const;
+        [[nodiscard]] std::chrono::microseconds getLuaGarbageCollectionTime() const;
 
     private:
         LogicNodesTimed m_nodesExecuted;
@@ -36,5 +39,8 @@ namespace rlogic::internal
         UpdateReport::ReportTimeUnits m_totalUpdateExecutionTime{ 0 };
         UpdateReport::ReportTimeUnits m_topologySortExecutionTime{ 0 };
         size_t m_activatedLinks = 0u;
+        size_t m_deferredNodes = 0u;
+        size_t m_luaMemoryUsage = 0u;
+        UpdateReport::ReportTimeUnits m_luaGarbageCollectionTime{ 0 };
     };
 }
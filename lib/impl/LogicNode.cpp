@@ -8,6 +8,7 @@
 
 #include "ramses-logic/LogicNode.h"
 #include "impl/LogicNodeImpl.h"
+#include "impl/LoggerImpl.h"
 
 namespace rlogic
 {
@@ -34,4 +35,28 @@ namespace rlogic
     {
         return m_impl.getOutputs();
     }
+
+    bool LogicNode::setUpdateRateDivisor(uint32_t divisor)
+    {
+        if (divisor == 0u)
+        {
+            LOG_ERROR("LogicNode::setUpdateRateDivisor: update rate divisor of '{}' must be greater than 0", m_impl.getName());
+            return false;
+        }
+
+        m_impl.setUpdateRateDivisor(divisor);
+        return true;
+    }
+
+    uint32_t LogicNode::getUpdateRateDivisor() const
+    {
+        return m_impl.getUpdateRateDivisor();
+    }
+
+    std::vector<const Property*> LogicNode::collectChangedProperties(uint64_t sinceGeneration) const
+    {
+        std::vector<const Property*> changedProperties;
+        m_impl.collectChangedProperties(sinceGeneration, changedProperties);
+        return changedProperties;
+    }
 }
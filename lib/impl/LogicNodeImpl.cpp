@@ -11,6 +11,10 @@
 #include "ramses-logic/Property.h"
 
 #include "impl/PropertyImpl.h"
+#include "internals/DirtyNodeWorklist.h"
+#include "internals/TypeUtils.h"
+
+#include <cassert>
 
 namespace rlogic::internal
 {
@@ -41,9 +45,98 @@ namespace rlogic::internal
         return m_outputs.get();
     }
 
+    bool LogicNodeImpl::canUpdateConcurrently() const
+    {
+        return false;
+    }
+
+    const void* LogicNodeImpl::getConcurrentUpdateGroup() const
+    {
+        return nullptr;
+    }
+
     void LogicNodeImpl::setDirty(bool dirty)
     {
         m_dirty = dirty;
+        if (m_dirtyWorklist == nullptr)
+            return;
+
+        // worklist mirrors dirtiness, so that no update path (e.g. level-wise update) leaves stale marks behind
+        if (dirty)
+            m_dirtyWorklist->mark(m_dirtyWorklistRank);
+        else
+            m_dirtyWorklist->unmark(m_dirtyWorklistRank);
+    }
+
+    void LogicNodeImpl::setDirtyWorklist(DirtyNodeWorklist* worklist, size_t rank)
+    {
+        m_dirtyWorklist = worklist;
+        m_dirtyWorklistRank = rank;
+    }
+
+    void LogicNodeImpl::setGraphIndex(size_t index)
+    {
+        m_graphIndex = index;
+    }
+
+    size_t LogicNodeImpl::getGraphIndex() const
+    {
+        return m_graphIndex;
+    }
+
+    void LogicNodeImpl::setUpdateRateDivisor(uint32_t divisor)
+    {
+        assert(divisor > 0u);
+        m_updateRateDivisor = divisor;
+    }
+
+    uint32_t LogicNodeImpl::getUpdateRateDivisor() const
+    {
+        return m_updateRateDivisor;
+    }
+
+    void LogicNodeImpl::setUpdateGenerationCounter(const uint64_t* counter)
+    {
+        m_updateGenerationCounter = counter;
+    }
+
+    uint64_t LogicNodeImpl::markPropertyValueChanged()
+    {
+        m_lastChangeGeneration = (m_updateGenerationCounter != nullptr ? *m_updateGenerationCounter : 0u) + 1u;
+        return m_lastChangeGeneration;
+    }
+
+    uint64_t LogicNodeImpl::getLastChangeGeneration() const
+    {
+        return m_lastChangeGeneration;
+    }
+
+    void LogicNodeImpl::collectChangedProperties(uint64_t sinceGeneration, std::vector<const Property*>& changedProperties) const
+    {
+        if (m_lastChangeGeneration <= sinceGeneration)
+            return;
+
+        const Property* inputs = getInputs();
+        const Property* outputs = getOutputs();
+        if (inputs != nullptr)
+            CollectChangedProperties(*inputs, sinceGeneration, changedProperties);
+        // interface outputs are the same properties as its inputs
+        if (outputs != nullptr && outputs != inputs)
+            CollectChangedProperties(*outputs, sinceGeneration, changedProperties);
+    }
+
+    void LogicNodeImpl::CollectChangedProperties(const Property& property, uint64_t sinceGeneration, std::vector<const Property*>& changedProperties)
+    {
+        if (TypeUtils::IsPrimitiveType(property.getType()))
+        {
+            if (property.m_impl->getChangeGeneration() > sinceGeneration)
+                changedProperties.push_back(&property);
+            return;
+        }
+
+        const auto childCount = property.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+            CollectChangedProperties(*property.getChild(i), sinceGeneration, changedProperties);
     }
 
     bool LogicNodeImpl::isDirty() const
@@ -51,6 +144,47 @@ namespace rlogic::internal
         return m_dirty;
     }
 
+    const std::vector<LinkPropagationEntry>& LogicNodeImpl::getLinkPropagationTable()
+    {
+        if (!m_linkPropagationTableValid)
+        {
+            m_linkPropagationTable.clear();
+            const Property* outputs = getOutputs();
+            if (outputs != nullptr)
+                CollectOutgoingLinks(*outputs->m_impl, m_linkPropagationTable);
+            m_linkPropagationTableValid = true;
+        }
+
+        return m_linkPropagationTable;
+    }
+
+    void LogicNodeImpl::invalidateLinkPropagationTable()
+    {
+        m_linkPropagationTableValid = false;
+    }
+
+    void LogicNodeImpl::CollectOutgoingLinks(const PropertyImpl& output, std::vector<LinkPropagationEntry>& links)
+    {
+        const auto childCount = output.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+        {
+            const PropertyImpl& child = *output.getChild(i)->m_impl;
+
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                CollectOutgoingLinks(child, links);
+            }
+            else
+            {
+                for (const auto& outLink : child.getOutgoingLinks())
+                {
+                    PropertyImpl& target = *outLink.property;
+                    links.push_back({ &child, &target, &target.getLogicNode(), target.getPropertySemantics() == EPropertySemantics::AnimationInput });
+                }
+            }
+        }
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput)
     {
         m_inputs = std::move(rootInput);
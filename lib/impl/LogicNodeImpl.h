@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 #include <optional>
+#include <limits>
 
 namespace rlogic
 {
@@ -25,6 +26,19 @@ namespace rlogic::internal
 {
     struct LogicNodeRuntimeError { std::string message; };
 
+    class DirtyNodeWorklist;
+    class PropertyImpl;
+
+    // One link from a primitive output of a node to a primitive input of another node
+    struct LinkPropagationEntry
+    {
+        const PropertyImpl* source = nullptr;
+        PropertyImpl* target = nullptr;
+        LogicNodeImpl* targetNode = nullptr;
+        // target node is set dirty even if the propagated value did not change
+        bool alwaysActivate = false;
+    };
+
     class LogicNodeImpl : public LogicObjectImpl
     {
     public:
@@ -43,16 +57,57 @@ namespace rlogic::internal
         virtual void createRootProperties() = 0;
         virtual std::optional<LogicNodeRuntimeError> update() = 0;
 
+        // Nodes which don't access Lua nor Ramses objects in update() can be executed on worker threads
+        [[nodiscard]] virtual bool canUpdateConcurrently() const;
+        // Nodes returning the same non-null group are never executed concurrently with each other (e.g. scripts sharing a Lua state)
+        [[nodiscard]] virtual const void* getConcurrentUpdateGroup() const;
+
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
+        // Node marks itself in the worklist (at given rank) whenever it is set dirty and unmarks itself when set not dirty
+        void setDirtyWorklist(DirtyNodeWorklist* worklist, size_t rank);
+
+        // Dense index of this node in the dependency graph of its logic engine, assigned when the node is added to the graph
+        static constexpr size_t InvalidGraphIndex = std::numeric_limits<size_t>::max();
+        void setGraphIndex(size_t index);
+        [[nodiscard]] size_t getGraphIndex() const;
+
+        // Node is executed (if dirty) only in every N-th update, see LogicNode::setUpdateRateDivisor
+        void setUpdateRateDivisor(uint32_t divisor);
+        [[nodiscard]] uint32_t getUpdateRateDivisor() const;
+
+        // Number of updates executed by the logic engine, changed property values are stamped with the generation of the update
+        // which will consume them (i.e. counter + 1), see LogicEngine::getUpdateGeneration
+        void setUpdateGenerationCounter(const uint64_t* counter);
+        // Returns generation to stamp changed property value with and remembers it as latest change of this node
+        [[nodiscard]] uint64_t markPropertyValueChanged();
+        [[nodiscard]] uint64_t getLastChangeGeneration() const;
+        // Appends primitive input and output properties whose value changed after given generation
+        void collectChangedProperties(uint64_t sinceGeneration, std::vector<const Property*>& changedProperties) const;
+
+        // All outgoing links of this node's outputs in a flat list (ordered as the output leaves), built on first use after links changed
+        [[nodiscard]] const std::vector<LinkPropagationEntry>& getLinkPropagationTable();
+        void invalidateLinkPropagationTable();
+
     protected:
         void setRootProperties(std::unique_ptr<Property> rootInput, std::unique_ptr<Property> rootOutput);
 
     private:
+        static void CollectOutgoingLinks(const PropertyImpl& output, std::vector<LinkPropagationEntry>& links);
+        static void CollectChangedProperties(const Property& property, uint64_t sinceGeneration, std::vector<const Property*>& changedProperties);
+
         std::unique_ptr<Property> m_inputs;
         std::unique_ptr<Property> m_outputs;
         // Dirty after creation (every node gets executed at least once after creation)
         bool                      m_dirty = true;
+        DirtyNodeWorklist*        m_dirtyWorklist = nullptr;
+        size_t                    m_dirtyWorklistRank = 0u;
+        size_t                    m_graphIndex = InvalidGraphIndex;
+        uint32_t                  m_updateRateDivisor = 1u;
+        const uint64_t*           m_updateGenerationCounter = nullptr;
+        uint64_t                  m_lastChangeGeneration = 0u;
+        std::vector<LinkPropagationEntry> m_linkPropagationTable;
+        bool                      m_linkPropagationTableValid = false;
     };
 }
@@ -58,13 +58,14 @@ namespace rlogic::internal
         return fmt::format("{} [Id={}]", m_name, m_id);
     }
 
-    flatbuffers::Offset<rlogic_serialization::LogicObject> LogicObjectImpl::Serialize(const LogicObjectImpl& object, flatbuffers::FlatBufferBuilder& builder)
+    flatbuffers::Offset<rlogic_serialization::LogicObject> LogicObjectImpl::Serialize(const LogicObjectImpl& object, flatbuffers::FlatBufferBuilder& builder, uint32_t updateRateDivisor)
     {
         return rlogic_serialization::CreateLogicObject(builder,
             builder.CreateString(object.m_name),
             object.m_id,
             object.m_userId.first,
-            object.m_userId.second
+            object.m_userId.second,
+            updateRateDivisor
             );
     }
 
@@ -93,6 +94,12 @@ namespace rlogic::internal
             return false;
         }
 
+        if (object->updateRateDivisor() == 0u)
+        {
+            errorReporting.add("Fatal error during loading of LogicObject base from serialized data: invalid update rate divisor!", nullptr, EErrorType::BinaryVersionMismatch);
+            return false;
+        }
+
         name = object->name()->string_view();
         id = object->id();
         userIdHigh = object->userIdHigh();
@@ -51,7 +51,8 @@ namespace rlogic::internal
         [[nodiscard]] LogicObject& getLogicObject();
 
     protected:
-        static flatbuffers::Offset<rlogic_serialization::LogicObject> Serialize(const LogicObjectImpl& object, flatbuffers::FlatBufferBuilder& builder);
+        // Update rate divisor is only relevant for logic nodes, see LogicNodeImpl::setUpdateRateDivisor
+        static flatbuffers::Offset<rlogic_serialization::LogicObject> Serialize(const LogicObjectImpl& object, flatbuffers::FlatBufferBuilder& builder, uint32_t updateRateDivisor = 1u);
         static bool Deserialize(const rlogic_serialization::LogicObject* object,
             std::string& name,
             uint64_t& id,
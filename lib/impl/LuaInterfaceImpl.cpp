@@ -27,7 +27,7 @@ namespace rlogic::internal
         SerializationMap& serializationMap,
         EFeatureLevel /*featureLevel*/)
     {
-        const auto logicObject = LogicObjectImpl::Serialize(luaInterface, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(luaInterface, builder, luaInterface.getUpdateRateDivisor());
         const auto propertyObject = PropertyImpl::Serialize(*luaInterface.getInputs()->m_impl, builder, serializationMap);
         auto intf = rlogic_serialization::CreateLuaInterface(builder, logicObject, propertyObject);
         builder.Finish(intf);
@@ -82,6 +82,7 @@ namespace rlogic::internal
             },
             name, id);
         deserialized->setUserId(userIdHigh, userIdLow);
+        deserialized->setUpdateRateDivisor(luaInterface.base()->updateRateDivisor());
 
         return deserialized;
     }
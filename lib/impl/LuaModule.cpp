@@ -19,4 +19,9 @@ namespace rlogic
     }
 
     LuaModule::~LuaModule() noexcept = default;
+
+    size_t LuaModule::getMemoryUsage() const
+    {
+        return m_impl.getMemoryUsage();
+    }
 }
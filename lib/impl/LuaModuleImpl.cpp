@@ -20,6 +20,7 @@
 #include "internals/EnvironmentProtection.h"
 #include "internals/PropertyTypeExtractor.h"
 #include <fmt/format.h>
+#include <algorithm>
 
 namespace rlogic::internal
 {
@@ -28,16 +29,57 @@ namespace rlogic::internal
         , m_sourceCode{ std::move(module.source.sourceCode) }
         , m_byteCode{ std::move(module.source.byteCode) }
         , m_module{ std::move(module.moduleTable) }
+        , m_solState{ module.source.solState.get() }
         , m_dependencies{ std::move(module.source.userModules) }
         , m_stdModules{ std::move(module.source.stdModules) }
         , m_hasDebugLogFunctions{ module.source.hasDebugLogFunctions }
+        , m_compilationCacheEntry{ std::move(module.source.cacheEntry) }
     {
         assert(m_module != sol::nil);
+        m_memoryAccounts.push_back(std::move(module.source.memoryAccount));
     }
 
-    const sol::table& LuaModuleImpl::getModule() const
+    size_t LuaModuleImpl::getMemoryUsage() const
     {
-        return m_module;
+        size_t usedBytes = 0u;
+        for (const auto& account : m_memoryAccounts)
+            usedBytes += account->usedBytes;
+        return usedBytes;
+    }
+
+    const sol::table& LuaModuleImpl::getModule(const SolState& solState) const
+    {
+        if (&solState == &m_solState)
+            return m_module;
+
+        const auto it = std::find_if(m_modulesInOtherStates.cbegin(), m_modulesInOtherStates.cend(), [&solState](const auto& m) { return m.first == &solState; });
+        assert(it != m_modulesInOtherStates.cend() && "Module was not loaded into this Lua state!");
+        return it->second;
+    }
+
+    bool LuaModuleImpl::loadIntoSolState(SolState& solState, EFeatureLevel featureLevel, ErrorReporting& errorReporting)
+    {
+        if (&solState == &m_solState ||
+            std::any_of(m_modulesInOtherStates.cbegin(), m_modulesInOtherStates.cend(), [&solState](const auto& m) { return m.first == &solState; }))
+        {
+            return true;
+        }
+
+        for (const auto& dependency : m_dependencies)
+        {
+            if (!dependency.second->m_impl.loadIntoSolState(solState, featureLevel, errorReporting))
+                return false;
+        }
+
+        // byte code and source are independent of Lua state, prefer byte code to avoid compiling again
+        auto compiledModule = LuaCompilationUtils::CompileModuleOrImportPrecompiled(
+            solState, m_dependencies, m_stdModules, m_sourceCode, getName(), errorReporting, m_byteCode, featureLevel, m_hasDebugLogFunctions);
+        if (!compiledModule)
+            return false;
+
+        m_modulesInOtherStates.emplace_back(&solState, std::move(compiledModule->moduleTable));
+        m_memoryAccounts.push_back(std::move(compiledModule->source.memoryAccount));
+        return true;
     }
 
     flatbuffers::Offset<rlogic_serialization::LuaModule> LuaModuleImpl::Serialize(
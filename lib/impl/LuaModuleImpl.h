@@ -13,7 +13,10 @@
 #include "internals/SolWrapper.h"
 #include "ramses-logic/EFeatureLevel.h"
 #include "ramses-logic/ELuaSavingMode.h"
+#include <memory>
 #include <string>
+#include <vector>
+#include <utility>
 
 namespace rlogic_serialization
 {
@@ -43,9 +46,14 @@ namespace rlogic::internal
     public:
         LuaModuleImpl(LuaCompiledModule module, std::string_view name, uint64_t id);
 
-        [[nodiscard]] const sol::table& getModule() const;
+        // Module table in given Lua state, module must be loaded in that state (see loadIntoSolState)
+        [[nodiscard]] const sol::table& getModule(const SolState& solState) const;
+        // Loads module and its dependencies into another Lua state so that scripts executed in it can use the module, does nothing if already loaded
+        [[nodiscard]] bool loadIntoSolState(SolState& solState, EFeatureLevel featureLevel, ErrorReporting& errorReporting);
         [[nodiscard]] const ModuleMapping& getDependencies() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
+        // Lua memory owned by module in all Lua states it is loaded into
+        [[nodiscard]] size_t getMemoryUsage() const;
 
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::LuaModule> Serialize(
             const LuaModuleImpl& module,
@@ -64,8 +72,14 @@ namespace rlogic::internal
         std::string m_sourceCode;
         sol::bytecode m_byteCode;
         sol::table m_module;
+        const SolState& m_solState;
+        // module tables of the same module in additional Lua states
+        std::vector<std::pair<const SolState*, sol::table>> m_modulesInOtherStates;
         ModuleMapping m_dependencies;
         StandardModules m_stdModules;
         bool m_hasDebugLogFunctions;
+        std::vector<LuaMemoryAccountPtr> m_memoryAccounts;
+        // keeps entry of shared compilation cache alive while module exists
+        std::shared_ptr<const LuaCompilationCache::Entry> m_compilationCacheEntry;
     };
 }
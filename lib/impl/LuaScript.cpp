@@ -19,4 +19,14 @@ namespace rlogic
     }
 
     LuaScript::~LuaScript() noexcept = default;
+
+    size_t LuaScript::getMemoryUsage() const
+    {
+        return m_script.getMemoryUsage();
+    }
+
+    void LuaScript::setMemoryLimit(size_t maxBytes)
+    {
+        m_script.setMemoryLimit(maxBytes);
+    }
 }
@@ -26,18 +26,22 @@
 
 namespace rlogic::internal
 {
-    LuaScriptImpl::LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id)
+    LuaScriptImpl::LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id, std::shared_ptr<const LuaScriptCode> sharedCode)
         : LogicNodeImpl(name, id)
-        , m_source(std::move(compiledScript.source.sourceCode))
-        , m_byteCode(std::move(compiledScript.source.byteCode))
+        , m_code(sharedCode ? std::move(sharedCode)
+            : std::make_shared<const LuaScriptCode>(LuaScriptCode{ std::move(compiledScript.source.sourceCode), std::move(compiledScript.source.byteCode), std::move(compiledScript.source.cacheEntry) }))
         , m_wrappedRootInput(*compiledScript.rootInput->m_impl)
         , m_wrappedRootOutput(*compiledScript.rootOutput->m_impl)
         , m_runFunction(std::move(compiledScript.runFunction))
         , m_modules(std::move(compiledScript.source.userModules))
         , m_stdModules(std::move(compiledScript.source.stdModules))
+        , m_solState{ compiledScript.source.solState.get() }
         , m_hasDebugLogFunctions{ compiledScript.source.hasDebugLogFunctions }
+        , m_memoryAccount{ std::move(compiledScript.source.memoryAccount) }
     {
         setRootProperties(std::move(compiledScript.rootInput), std::move(compiledScript.rootOutput));
+        m_luaRootInput = sol::make_object(m_runFunction.lua_state(), std::ref(m_wrappedRootInput));
+        m_luaRootOutput = sol::make_object(m_runFunction.lua_state(), std::ref(m_wrappedRootOutput));
     }
 
     void LuaScriptImpl::createRootProperties()
@@ -71,31 +75,42 @@ namespace rlogic::internal
             stdModules.push_back(static_cast<uint8_t>(stdModule));
         }
 
-        const auto fbLogicObject = LogicObjectImpl::Serialize(luaScript, builder);
+        const auto fbLogicObject = LogicObjectImpl::Serialize(luaScript, builder, luaScript.getUpdateRateDivisor());
         const auto fbModulesVec = builder.CreateVector(userModules);
         const auto fbStdModulesVec = builder.CreateVector(stdModules);
         const auto fbInputPropertyObject = PropertyImpl::Serialize(*luaScript.getInputs()->m_impl, builder, serializationMap);
         const auto fbOuputPropertyObject = PropertyImpl::Serialize(*luaScript.getOutputs()->m_impl, builder, serializationMap);
 
-        const bool hasSourceCode = !luaScript.m_source.empty();
-        const bool hasByteCode = !luaScript.m_byteCode.empty();
+        const LuaScriptCode& code = *luaScript.m_code;
+        const bool hasSourceCode = !code.source.empty();
+        const bool hasByteCode = !code.byteCode.empty();
         assert(hasSourceCode || hasByteCode);
         const bool serializeSourceCode = hasSourceCode && !((luaSavingMode == ELuaSavingMode::ByteCodeOnly) && hasByteCode);
         const bool serializeByteCode = hasByteCode && !((luaSavingMode == ELuaSavingMode::SourceCodeOnly) && hasSourceCode);
         assert(serializeSourceCode || serializeByteCode);
 
-        const auto fbSrcCode = (serializeSourceCode ? builder.CreateString(luaScript.m_source) : 0);
+        // instances of same script store their source only once
+        flatbuffers::Offset<flatbuffers::String> fbSrcCode{};
+        if (serializeSourceCode)
+        {
+            fbSrcCode = serializationMap.resolveSourceCodeOffsetIfFound(code.source);
+            if (fbSrcCode.IsNull())
+            {
+                fbSrcCode = builder.CreateString(code.source);
+                serializationMap.storeSourceCodeOffset(code.source, fbSrcCode);
+            }
+        }
 
         flatbuffers::Offset<flatbuffers::Vector<uint8_t>> byteCodeOffset{};
         if (serializeByteCode)
         {
-            std::string byteCodeString{ luaScript.m_byteCode.as_string_view() };
+            std::string byteCodeString{ code.byteCode.as_string_view() };
             byteCodeOffset = serializationMap.resolveByteCodeOffsetIfFound(byteCodeString);
             if (byteCodeOffset.IsNull())
             {
                 std::vector<uint8_t> byteCodeAsVectorUInt8;
-                byteCodeAsVectorUInt8.reserve(luaScript.m_byteCode.size());
-                std::transform(luaScript.m_byteCode.cbegin(), luaScript.m_byteCode.cend(), std::back_inserter(byteCodeAsVectorUInt8), [](std::byte b) { return uint8_t(b); });
+                byteCodeAsVectorUInt8.reserve(code.byteCode.size());
+                std::transform(code.byteCode.cbegin(), code.byteCode.cend(), std::back_inserter(byteCodeAsVectorUInt8), [](std::byte b) { return uint8_t(b); });
 
                 byteCodeOffset = builder.CreateVector(byteCodeAsVectorUInt8);
                 serializationMap.storeByteCodeOffset(std::move(byteCodeString), byteCodeOffset);
@@ -214,7 +229,15 @@ namespace rlogic::internal
         auto inputs = std::make_unique<Property>(std::move(rootInput));
         auto outputs = std::make_unique<Property>(std::move(rootOutput));
 
-        std::string sourceCode = (hasSourceCode ? luaScript.luaSourceCode()->str() : "");
+        // instances of same script were saved with same source/byte code, they share it again after loading
+        const void* serializedCode = (hasBytecode ? static_cast<const void*>(luaScript.luaByteCode()) : static_cast<const void*>(luaScript.luaSourceCode()));
+        std::shared_ptr<const LuaScriptCode> sharedCode = deserializationMap.resolveLuaScriptCodeIfFound(serializedCode);
+        const std::string_view serializedSource = (hasSourceCode ? luaScript.luaSourceCode()->string_view() : std::string_view{});
+        if (sharedCode && sharedCode->source != serializedSource)
+            sharedCode.reset();
+        const bool storeSharedCode = !sharedCode;
+
+        std::string sourceCode{ serializedSource };
         sol::bytecode byteCode;
         if (hasBytecode)
         {
@@ -243,19 +266,62 @@ namespace rlogic::internal
 
         auto deserialized = std::make_unique<LuaScriptImpl>(
             std::move(*compiledScript),
-            name, id);
+            name, id, std::move(sharedCode));
+        if (storeSharedCode)
+            deserializationMap.storeLuaScriptCode(serializedCode, deserialized->getCode());
 
         deserialized->setUserId(userIdHigh, userIdLow);
 
+        deserialized->setUpdateRateDivisor(luaScript.base()->updateRateDivisor());
+
         return deserialized;
     }
 
+    void LuaScriptImpl::enableConcurrentUpdate(bool enabled)
+    {
+        m_concurrentUpdateEnabled = enabled;
+    }
+
+    bool LuaScriptImpl::canUpdateConcurrently() const
+    {
+        return m_concurrentUpdateEnabled;
+    }
+
+    const void* LuaScriptImpl::getConcurrentUpdateGroup() const
+    {
+        return &m_solState;
+    }
+
+    const SolState& LuaScriptImpl::getSolState() const
+    {
+        return m_solState;
+    }
+
+    void LuaScriptImpl::setMemoryLimit(size_t maxBytes)
+    {
+        m_memoryAccount->limit = maxBytes;
+    }
+
+    size_t LuaScriptImpl::getMemoryUsage() const
+    {
+        return m_memoryAccount->usedBytes;
+    }
+
     std::optional<LogicNodeRuntimeError> LuaScriptImpl::update()
     {
-        sol::protected_function_result result = m_runFunction(std::ref(m_wrappedRootInput), std::ref(m_wrappedRootOutput));
+        m_memoryAccount->limitExceeded = false;
+        sol::protected_function_result result{};
+        {
+            const LuaAllocator::ScopedAttribution memoryAttribution{ *m_memoryAccount };
+            result = m_runFunction(m_luaRootInput, m_luaRootOutput);
+        }
 
         if (!result.valid())
         {
+            // Lua reports failed allocation as generic out of memory error
+            if (m_memoryAccount->limitExceeded)
+                return LogicNodeRuntimeError{ fmt::format("Lua script exceeded its memory limit of {} bytes!", m_memoryAccount->limit) };
+
             sol::error error = result;
             return LogicNodeRuntimeError{error.what()};
         }
@@ -268,6 +334,16 @@ namespace rlogic::internal
         return m_modules;
     }
 
+    const StandardModules& LuaScriptImpl::getStandardModules() const
+    {
+        return m_stdModules;
+    }
+
+    const std::shared_ptr<const LuaScriptCode>& LuaScriptImpl::getCode() const
+    {
+        return m_code;
+    }
+
     bool LuaScriptImpl::hasDebugLogFunctions() const
     {
         return m_hasDebugLogFunctions;
@@ -46,10 +46,20 @@ namespace rlogic::internal
     class SolState;
     class SerializationMap;
 
+    // Source and byte code of script, shared by all instances of same script (see LogicEngine::createLuaScriptInstance)
+    struct LuaScriptCode
+    {
+        std::string source;
+        sol::bytecode byteCode;
+        // keeps entry of shared compilation cache alive while any script uses this code
+        std::shared_ptr<const LuaCompilationCache::Entry> compilationCacheEntry;
+    };
+
     class LuaScriptImpl : public LogicNodeImpl
     {
     public:
-        explicit LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id);
+        // Source and byte code of compiled script are ignored if shared code is given, i.e. script is instance of another script
+        explicit LuaScriptImpl(LuaCompiledScript compiledScript, std::string_view name, uint64_t id, std::shared_ptr<const LuaScriptCode> sharedCode = nullptr);
         ~LuaScriptImpl() noexcept override = default;
         LuaScriptImpl(const LuaScriptImpl & other) = delete;
         LuaScriptImpl& operator=(const LuaScriptImpl & other) = delete;
@@ -69,19 +79,36 @@ namespace rlogic::internal
 
         std::optional<LogicNodeRuntimeError> update() override;
 
+        // Scripts can run on worker threads if each Lua state is used by one thread at a time, see ApiObjects::setLuaStateCount
+        void enableConcurrentUpdate(bool enabled);
+        [[nodiscard]] bool canUpdateConcurrently() const override;
+        [[nodiscard]] const void* getConcurrentUpdateGroup() const override;
+        [[nodiscard]] const SolState& getSolState() const;
+
+        // Limit of Lua memory owned by script, 0 for unlimited, see LuaAllocator
+        void setMemoryLimit(size_t maxBytes);
+        [[nodiscard]] size_t getMemoryUsage() const;
+
         [[nodiscard]] const ModuleMapping& getModules() const;
+        [[nodiscard]] const StandardModules& getStandardModules() const;
+        [[nodiscard]] const std::shared_ptr<const LuaScriptCode>& getCode() const;
         [[nodiscard]] bool hasDebugLogFunctions() const;
 
         void createRootProperties() final;
 
     private:
-        std::string             m_source;
-        sol::bytecode           m_byteCode;
+        std::shared_ptr<const LuaScriptCode> m_code;
         WrappedLuaProperty      m_wrappedRootInput;
         WrappedLuaProperty      m_wrappedRootOutput;
         sol::protected_function m_runFunction;
+        // wrapped root properties as Lua objects, created once so that calling run() does not allocate outside of protected call
+        sol::object             m_luaRootInput;
+        sol::object             m_luaRootOutput;
         ModuleMapping           m_modules;
         StandardModules         m_stdModules;
+        const SolState&         m_solState;
         bool m_hasDebugLogFunctions;
+        bool m_concurrentUpdateEnabled = false;
+        LuaMemoryAccountPtr     m_memoryAccount;
     };
 }
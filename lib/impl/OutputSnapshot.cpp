@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-logic/OutputSnapshot.h"
+#include "impl/OutputSnapshotImpl.h"
+
+namespace rlogic
+{
+    OutputSnapshot::OutputSnapshot(std::unique_ptr<internal::OutputSnapshotImpl> impl) noexcept
+        : m_impl{ std::move(impl) }
+    {
+    }
+
+    OutputSnapshot::~OutputSnapshot() noexcept = default;
+
+    bool OutputSnapshot::acquireLatest()
+    {
+        return m_impl->acquireLatest();
+    }
+
+    uint64_t OutputSnapshot::getVersion() const
+    {
+        return m_impl->getVersion();
+    }
+
+    size_t OutputSnapshot::getValueCount() const
+    {
+        return m_impl->getValueCount();
+    }
+
+    template <typename T> std::optional<T> OutputSnapshot::getInternal(size_t index) const
+    {
+        return m_impl->getValue<T>(index);
+    }
+
+    template RLOGIC_API std::optional<float>       OutputSnapshot::getInternal<float>(size_t) const;
+    template RLOGIC_API std::optional<vec2f>       OutputSnapshot::getInternal<vec2f>(size_t) const;
+    template RLOGIC_API std::optional<vec3f>       OutputSnapshot::getInternal<vec3f>(size_t) const;
+    template RLOGIC_API std::optional<vec4f>       OutputSnapshot::getInternal<vec4f>(size_t) const;
+    template RLOGIC_API std::optional<int32_t>     OutputSnapshot::getInternal<int32_t>(size_t) const;
+    template RLOGIC_API std::optional<int64_t>     OutputSnapshot::getInternal<int64_t>(size_t) const;
+    template RLOGIC_API std::optional<vec2i>       OutputSnapshot::getInternal<vec2i>(size_t) const;
+    template RLOGIC_API std::optional<vec3i>       OutputSnapshot::getInternal<vec3i>(size_t) const;
+    template RLOGIC_API std::optional<vec4i>       OutputSnapshot::getInternal<vec4i>(size_t) const;
+    template RLOGIC_API std::optional<std::string> OutputSnapshot::getInternal<std::string>(size_t) const;
+    template RLOGIC_API std::optional<bool>        OutputSnapshot::getInternal<bool>(size_t) const;
+}
@@ -0,0 +1,113 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "impl/OutputSnapshotImpl.h"
+#include "impl/LogicNodeImpl.h"
+
+namespace rlogic::internal
+{
+    void OutputSnapshotImpl::setProperties(std::vector<const PropertyImpl*> properties)
+    {
+        // all three buffers get their value storage allocated here, publishing then only overwrites values in place
+        // (string values reuse their capacity, they allocate only when a longer string than ever before is published)
+        Snapshot initialSnapshot;
+        initialSnapshot.values.reserve(properties.size());
+        m_properties.clear();
+        m_properties.reserve(properties.size());
+        for (const PropertyImpl* property : properties)
+        {
+            initialSnapshot.values.push_back(property->getValue());
+            m_properties.push_back({ property, &property->getLogicNode() });
+        }
+
+        m_lastPublishedVersion = 0u;
+        m_snapshots.reset(initialSnapshot);
+    }
+
+    void OutputSnapshotImpl::removePropertiesOf(const LogicNodeImpl* node)
+    {
+        for (auto& selectedProperty : m_properties)
+        {
+            if (selectedProperty.owner == node)
+                selectedProperty.property = nullptr;
+        }
+    }
+
+    void OutputSnapshotImpl::clearProperties()
+    {
+        // nothing was ever selected or last selection was empty, reader has empty snapshot already
+        if (m_properties.empty() && m_snapshots.getLastPublishedBuffer().values.empty())
+            return;
+
+        m_properties.clear();
+        Snapshot& snapshot = m_snapshots.getWriteBuffer();
+        snapshot.values.clear();
+        snapshot.version = ++m_lastPublishedVersion;
+        m_snapshots.publish();
+    }
+
+    void OutputSnapshotImpl::publish()
+    {
+        if (m_properties.empty())
+            return;
+
+        // write buffer holds values of some older snapshot, properties of destroyed nodes take their values from the last published one
+        Snapshot& snapshot = m_snapshots.getWriteBuffer();
+        for (size_t i = 0u; i < m_properties.size(); ++i)
+        {
+            if (m_properties[i].property != nullptr)
+                snapshot.values[i] = m_properties[i].property->getValue();
+            else
+                snapshot.values[i] = m_snapshots.getLastPublishedBuffer().values[i];
+        }
+        snapshot.version = ++m_lastPublishedVersion;
+
+        m_snapshots.publish();
+    }
+
+    bool OutputSnapshotImpl::acquireLatest()
+    {
+        return m_snapshots.acquireLatest();
+    }
+
+    uint64_t OutputSnapshotImpl::getVersion() const
+    {
+        return m_snapshots.getReadBuffer().version;
+    }
+
+    size_t OutputSnapshotImpl::getValueCount() const
+    {
+        return m_snapshots.getReadBuffer().values.size();
+    }
+
+    template <typename T>
+    std::optional<T> OutputSnapshotImpl::getValue(size_t index) const
+    {
+        const std::vector<PropertyValue>& values = m_snapshots.getReadBuffer().values;
+        if (index >= values.size())
+            return std::nullopt;
+
+        const T* value = std::get_if<T>(&values[index]);
+        if (value == nullptr)
+            return std::nullopt;
+
+        return *value;
+    }
+
+    template std::optional<float>       OutputSnapshotImpl::getValue<float>(size_t) const;
+    template std::optional<vec2f>       OutputSnapshotImpl::getValue<vec2f>(size_t) const;
+    template std::optional<vec3f>       OutputSnapshotImpl::getValue<vec3f>(size_t) const;
+    template std::optional<vec4f>       OutputSnapshotImpl::getValue<vec4f>(size_t) const;
+    template std::optional<int32_t>     OutputSnapshotImpl::getValue<int32_t>(size_t) const;
+    template std::optional<int64_t>     OutputSnapshotImpl::getValue<int64_t>(size_t) const;
+    template std::optional<vec2i>       OutputSnapshotImpl::getValue<vec2i>(size_t) const;
+    template std::optional<vec3i>       OutputSnapshotImpl::getValue<vec3i>(size_t) const;
+    template std::optional<vec4i>       OutputSnapshotImpl::getValue<vec4i>(size_t) const;
+    template std::optional<std::string> OutputSnapshotImpl::getValue<std::string>(size_t) const;
+    template std::optional<bool>        OutputSnapshotImpl::getValue<bool>(size_t) const;
+}
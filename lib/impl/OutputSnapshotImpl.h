@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/PropertyImpl.h"
+#include "internals/TripleBuffer.h"
+
+#include <vector>
+#include <optional>
+
+namespace rlogic::internal
+{
+    class LogicNodeImpl;
+
+    class OutputSnapshotImpl
+    {
+    public:
+        // Writer side (logic engine thread), not thread-safe with reader side
+        void setProperties(std::vector<const PropertyImpl*> properties);
+        // Properties of destroyed node keep their last published value, node is only used for comparison (can be already destroyed)
+        void removePropertiesOf(const LogicNodeImpl* node);
+        // Stops publishing and publishes an empty snapshot, wait-free and thus safe while reader side is active (unlike setProperties)
+        void clearProperties();
+
+        // Writer side, wait-free
+        void publish();
+
+        // Reader side, wait-free
+        bool acquireLatest();
+        [[nodiscard]] uint64_t getVersion() const;
+        [[nodiscard]] size_t getValueCount() const;
+        template <typename T>
+        [[nodiscard]] std::optional<T> getValue(size_t index) const;
+
+    private:
+        struct Snapshot
+        {
+            uint64_t version = 0u;
+            std::vector<PropertyValue> values;
+        };
+
+        struct SelectedProperty
+        {
+            const PropertyImpl* property = nullptr;
+            const LogicNodeImpl* owner = nullptr;
+        };
+
+        std::vector<SelectedProperty> m_properties;
+        uint64_t m_lastPublishedVersion = 0u;
+        TripleBuffer<Snapshot> m_snapshots;
+    };
+}
@@ -15,15 +15,65 @@
 #include "internals/SerializationHelper.h"
 #include "internals/TypeUtils.h"
 #include "internals/ErrorReporting.h"
+#include "internals/FixedSizePool.h"
 #include "internals/TypeUtils.h"
 
 #include "generated/PropertyGen.h"
 
 #include <cassert>
 #include <algorithm>
+#include <new>
+#include <cstddef>
 
 namespace rlogic::internal
 {
+    namespace
+    {
+        // pool of ApiObjects which currently creates logic nodes on this thread, see PropertyPoolScope
+        thread_local FixedSizePool* CurrentPropertyPool = nullptr;
+
+        // every allocation starts with pointer to the pool it came from (null if allocated from heap),
+        // so that properties can be deleted outside of the scope they were created in
+        constexpr size_t AllocationHeaderSize = std::max(sizeof(FixedSizePool*), alignof(PropertyImpl));
+    }
+
+    void* PropertyImpl::operator new(size_t size)
+    {
+        FixedSizePool* pool = (size == sizeof(PropertyImpl) ? CurrentPropertyPool : nullptr);
+        void* block = (pool != nullptr ? pool->allocate() : ::operator new(AllocationHeaderSize + size));
+        new (block) FixedSizePool*(pool);
+        return static_cast<std::byte*>(block) + AllocationHeaderSize;
+    }
+
+    void PropertyImpl::operator delete(void* ptr)
+    {
+        if (ptr == nullptr)
+            return;
+
+        void* block = static_cast<std::byte*>(ptr) - AllocationHeaderSize;
+        FixedSizePool* pool = *static_cast<FixedSizePool**>(block);
+        if (pool != nullptr)
+            pool->deallocate(block);
+        else
+            ::operator delete(block);
+    }
+
+    size_t PropertyImpl::GetPoolBlockSize()
+    {
+        return AllocationHeaderSize + sizeof(PropertyImpl);
+    }
+
+    PropertyPoolScope::PropertyPoolScope(FixedSizePool& pool)
+        : m_previousPool{ CurrentPropertyPool }
+    {
+        CurrentPropertyPool = &pool;
+    }
+
+    PropertyPoolScope::~PropertyPoolScope() noexcept
+    {
+        CurrentPropertyPool = m_previousPool;
+    }
+
     PropertyImpl::PropertyImpl(HierarchicalTypeData type, EPropertySemantics semantics)
         : m_typeData(std::move(type.typeData))
         , m_semantics(semantics)
@@ -73,10 +123,13 @@ namespace rlogic::internal
         }
         else
         {
-            for (const auto& childType : type.children)
+            // type data is owned by this call, move it to children instead of copying whole subtrees on each level
+            m_children.reserve(type.children.size());
+            for (auto& childType : type.children)
             {
-                m_children.emplace_back(std::make_unique<Property>(std::make_unique<PropertyImpl>(childType, semantics)));
+                m_children.emplace_back(std::make_unique<Property>(std::make_unique<PropertyImpl>(std::move(childType), semantics)));
             }
+            buildChildNameIndex();
         }
     }
 
@@ -89,16 +142,24 @@ namespace rlogic::internal
 
     PropertyImpl::~PropertyImpl() noexcept
     {
+        if (!m_rareData)
+            return;
+
         // TODO Violin/Vaclav discuss if we want to handle this here
-        if (m_incomingLink.property != nullptr)
+        if (m_rareData->incoming.property != nullptr)
         {
             resetIncomingLink();
         }
 
-        for (auto outgoingLink : m_outgoingLinks)
+        // resetIncomingLink could have released rare data of this property if there are no outgoing links
+        if (!m_rareData)
+            return;
+
+        for (auto outgoingLink : m_rareData->outgoing)
         {
-            assert(outgoingLink.property->m_incomingLink.property == this);
-            outgoingLink.property->m_incomingLink = { nullptr, false };
+            assert(outgoingLink.property->hasIncomingLink() && outgoingLink.property->m_rareData->incoming.property == this);
+            outgoingLink.property->m_rareData->incoming = { nullptr, false };
+            outgoingLink.property->releaseRareDataIfUnused();
         }
     }
 
@@ -387,6 +448,7 @@ namespace rlogic::internal
                 return nullptr;
             }
 
+            impl->m_children.reserve(prop.children()->size());
             for (const auto* child : *prop.children())
             {
                 if (!child)
@@ -405,6 +467,7 @@ namespace rlogic::internal
 
                 impl->m_children.emplace_back(std::make_unique<Property>(std::move(deserializedChild)));
             }
+            impl->buildChildNameIndex();
         }
 
         deserializationMap.storePropertyImpl(prop, *impl);
@@ -427,6 +490,16 @@ namespace rlogic::internal
         return m_typeData.name;
     }
 
+    HierarchicalTypeData PropertyImpl::getHierarchicalTypeData() const
+    {
+        std::vector<HierarchicalTypeData> childrenTypes;
+        childrenTypes.reserve(m_children.size());
+        for (const auto& child : m_children)
+            childrenTypes.push_back(child->m_impl->getHierarchicalTypeData());
+
+        return HierarchicalTypeData(m_typeData, std::move(childrenTypes));
+    }
+
     Property* PropertyImpl::getChild(size_t index)
     {
         if (index < m_children.size())
@@ -457,12 +530,10 @@ namespace rlogic::internal
 
     const Property* PropertyImpl::getChild(std::string_view name) const
     {
-        auto it = std::find_if(m_children.begin(), m_children.end(), [&name](const std::vector<std::unique_ptr<Property>>::value_type& property) {
-            return property->getName() == name;
-        });
-        if (it != m_children.end())
+        const std::optional<size_t> index = findChildIndex(name);
+        if (index)
         {
-            return it->get();
+            return m_children[*index].get();
         }
         LOG_ERROR("No child property with name '{}' found in '{}'", name, m_typeData.name);
         return nullptr;
@@ -470,9 +541,39 @@ namespace rlogic::internal
 
     bool PropertyImpl::hasChild(std::string_view name) const
     {
-        return m_children.end() != std::find_if(m_children.begin(), m_children.end(), [&name](const std::vector<std::unique_ptr<Property>>::value_type& property) {
+        return findChildIndex(name).has_value();
+    }
+
+    std::optional<size_t> PropertyImpl::findChildIndex(std::string_view name) const
+    {
+        if (m_rareData && !m_rareData->childNameIndex.empty())
+        {
+            const auto it = m_rareData->childNameIndex.find(name);
+            if (it != m_rareData->childNameIndex.end())
+                return it->second;
+            return std::nullopt;
+        }
+
+        auto it = std::find_if(m_children.begin(), m_children.end(), [&name](const std::vector<std::unique_ptr<Property>>::value_type& property) {
             return property->getName() == name;
-            });
+        });
+        if (it != m_children.end())
+            return static_cast<size_t>(std::distance(m_children.begin(), it));
+        return std::nullopt;
+    }
+
+    void PropertyImpl::buildChildNameIndex()
+    {
+        if (m_typeData.type != EPropertyType::Struct || m_children.size() < ChildNameIndexThreshold)
+            return;
+
+        auto& childNameIndex = getOrCreateRareData().childNameIndex;
+        childNameIndex.reserve(m_children.size());
+        for (size_t i = 0u; i < m_children.size(); ++i)
+        {
+            // first field wins in case of duplicate names, same as linear search
+            childNameIndex.emplace(m_children[i]->getName(), i);
+        }
     }
 
     std::vector<const Property*> PropertyImpl::collectLeafChildren() const
@@ -527,58 +628,198 @@ namespace rlogic::internal
     template std::optional<bool>        PropertyImpl::getValue_PublicApi<bool>() const;
 
     bool PropertyImpl::setValue_PublicApi(PropertyValue value)
+    {
+        return std::visit([this](auto& typedValue) {
+            const std::optional<std::string> error = checkValueCanBeSet_PublicApi(typedValue);
+            if (error)
+            {
+                LOG_ERROR("{}", *error);
+                return false;
+            }
+
+            if (setCheckedValue_PublicApi(std::move(typedValue)))
+                m_logicNode->setDirty(true);
+            return true;
+        }, value);
+    }
+
+    template <typename T>
+    std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi([[maybe_unused]] const T& value) const
     {
         if (m_semantics == EPropertySemantics::ScriptOutput)
+            return fmt::format("Cannot set property '{}' which is an output.", m_typeData.name);
+
+        if (hasIncomingLink())
+            return fmt::format("Property '{}' is currently linked (to property '{}'). Unlink it first before setting its value!", m_typeData.name, m_rareData->incoming.property->getName());
+
+        if (!TypeUtils::IsPrimitiveType(m_typeData.type))
+            return fmt::format("Property '{}' is not a primitive type, can't set its value directly!", m_typeData.name);
+
+        if (!std::holds_alternative<T>(m_value))
+            return fmt::format("Invalid type when setting property '{}', correct type is '{}'", m_typeData.name, GetLuaPrimitiveTypeName(m_typeData.type));
+
+        if constexpr (std::is_same_v<T, int64_t>)
         {
-            LOG_ERROR("Cannot set property '{}' which is an output.", m_typeData.name);
-            return false;
+            // Lua uses (by default) double for internal storage of numerical values.
+            // IEEE 754 64-bit double can represent higher integers than this (DBL_MAX) but this is the maximum
+            // for which double can represent this value and all values below correctly
+            static constexpr auto maxIntegerAsDouble = static_cast<int64_t>(1LLU << 53u);
+            if (value > maxIntegerAsDouble || value < -maxIntegerAsDouble)
+            {
+                return fmt::format("Invalid value when setting property '{}', Lua cannot handle full range of 64-bit integer, trying to set '{}' which is out of this range!",
+                    m_typeData.name, value);
+            }
         }
 
-        if (m_incomingLink.property != nullptr)
+        return std::nullopt;
+    }
+
+    template <typename T>
+    bool PropertyImpl::setCheckedValue_PublicApi(T value)
+    {
+        assert(std::holds_alternative<T>(m_value));
+
+        if (m_semantics == EPropertySemantics::BindingInput)
         {
-            LOG_ERROR("Property '{}' is currently linked (to property '{}'). Unlink it first before setting its value!", m_typeData.name, m_incomingLink.property->getName());
+            m_bindingInputHasNewValue = true;
+        }
+
+        // compare typed values directly, avoids variant dispatch and copy of unchanged values
+        T& currentValue = std::get<T>(m_value);
+        const bool valueChanged = (currentValue != value);
+        if (valueChanged)
+        {
+            currentValue = std::move(value);
+            markValueChanged();
+        }
+
+        // TODO Violin possibly remove interface properties from this check, add tests first that interface objects dont need to be set
+        // dirty if their inputs were set
+        return valueChanged || m_semantics == EPropertySemantics::AnimationInput || m_semantics == EPropertySemantics::BindingInput || m_semantics == EPropertySemantics::Interface;
+    }
+
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<float>(const float&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<vec2f>(const vec2f&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<vec3f>(const vec3f&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<vec4f>(const vec4f&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<int32_t>(const int32_t&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<int64_t>(const int64_t&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<vec2i>(const vec2i&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<vec3i>(const vec3i&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<vec4i>(const vec4i&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<std::string>(const std::string&) const;
+    template std::optional<std::string> PropertyImpl::checkValueCanBeSet_PublicApi<bool>(const bool&) const;
+
+    template bool PropertyImpl::setCheckedValue_PublicApi<float>(float);
+    template bool PropertyImpl::setCheckedValue_PublicApi<vec2f>(vec2f);
+    template bool PropertyImpl::setCheckedValue_PublicApi<vec3f>(vec3f);
+    template bool PropertyImpl::setCheckedValue_PublicApi<vec4f>(vec4f);
+    template bool PropertyImpl::setCheckedValue_PublicApi<int32_t>(int32_t);
+    template bool PropertyImpl::setCheckedValue_PublicApi<int64_t>(int64_t);
+    template bool PropertyImpl::setCheckedValue_PublicApi<vec2i>(vec2i);
+    template bool PropertyImpl::setCheckedValue_PublicApi<vec3i>(vec3i);
+    template bool PropertyImpl::setCheckedValue_PublicApi<vec4i>(vec4i);
+    template bool PropertyImpl::setCheckedValue_PublicApi<std::string>(std::string);
+    template bool PropertyImpl::setCheckedValue_PublicApi<bool>(bool);
+
+    template <typename T>
+    bool PropertyImpl::setArray_PublicApi(const T* values, size_t count)
+    {
+        if (m_typeData.type != EPropertyType::Array)
+        {
+            LOG_ERROR("Property '{}' is not an array, can't set its elements at once!", m_typeData.name);
             return false;
         }
 
-        if (!TypeUtils::IsPrimitiveType(m_typeData.type))
+        if (count != m_children.size())
         {
-            LOG_ERROR("Property '{}' is not a primitive type, can't set its value directly!", m_typeData.name);
+            LOG_ERROR("Invalid number of values when setting array property '{}', expected {} values but got {}", m_typeData.name, m_children.size(), count);
             return false;
         }
 
-        if (value.index() != m_value.index())
+        // empty array has nothing to set, values may be null then
+        if (values == nullptr && count != 0u)
         {
-            LOG_ERROR("Invalid type when setting property '{}', correct type is '{}'", m_typeData.name, GetLuaPrimitiveTypeName(m_typeData.type));
+            LOG_ERROR("Cannot set elements of array property '{}', values must not be null", m_typeData.name);
             return false;
         }
 
-        if (std::holds_alternative<int64_t>(value))
+        // validate all elements before modifying any of them, so that failed call has no effect
+        for (size_t i = 0u; i < count; ++i)
         {
-            // Lua uses (by default) double for internal storage of numerical values.
-            // IEEE 754 64-bit double can represent higher integers than this (DBL_MAX) but this is the maximum
-            // for which double can represent this value and all values below correctly
-            static constexpr auto maxIntegerAsDouble = static_cast<int64_t>(1LLU << 53u);
-            const auto int64Value = std::get<int64_t>(value);
-            if (int64Value > maxIntegerAsDouble || int64Value < -maxIntegerAsDouble)
+            const std::optional<std::string> error = m_children[i]->m_impl->checkValueCanBeSet_PublicApi(values[i]);
+            if (error)
             {
-                LOG_ERROR("Invalid value when setting property '{}', Lua cannot handle full range of 64-bit integer, trying to set '{}' which is out of this range!",
-                    m_typeData.name, int64Value);
+                LOG_ERROR("Cannot set element #{} of array property '{}': {}", i, m_typeData.name, *error);
                 return false;
             }
         }
 
-        // Marks corresponding node dirty if value changed
-        const bool valueChanged = setValue(std::move(value));
-        // TODO Violin possibly remove interface properties from this check, add tests first that interface objects dont need to be set
-        // dirty if their inputs were set
-        if (valueChanged || m_semantics == EPropertySemantics::AnimationInput || m_semantics == EPropertySemantics::BindingInput || m_semantics == EPropertySemantics::Interface)
+        bool needsDirty = false;
+        for (size_t i = 0u; i < count; ++i)
         {
+            if (m_children[i]->m_impl->setCheckedValue_PublicApi(values[i]))
+                needsDirty = true;
+        }
+
+        if (needsDirty)
             m_logicNode->setDirty(true);
+        return true;
+    }
+
+    template <typename T>
+    bool PropertyImpl::getArray_PublicApi(T* values, size_t count) const
+    {
+        // element type is checked on type data of every element, an empty array has no elements which could mismatch
+        const auto isElementOfTypeT = [](const std::unique_ptr<Property>& element) { return element->m_impl->m_typeData.type == PropertyTypeToEnum<T>::TYPE; };
+        if (m_typeData.type != EPropertyType::Array || !std::all_of(m_children.cbegin(), m_children.cend(), isElementOfTypeT))
+        {
+            LOG_ERROR("Invalid type '{}' when accessing elements of property '{}', property is not an array of this type",
+                GetLuaPrimitiveTypeName(PropertyTypeToEnum<T>::TYPE), m_typeData.name);
+            return false;
+        }
+
+        if (count != m_children.size())
+        {
+            LOG_ERROR("Invalid number of values when accessing array property '{}', expected {} values but got {}", m_typeData.name, m_children.size(), count);
+            return false;
+        }
+
+        if (values == nullptr && count != 0u)
+        {
+            LOG_ERROR("Cannot access elements of array property '{}', values must not be null", m_typeData.name);
+            return false;
         }
 
+        for (size_t i = 0u; i < count; ++i)
+            values[i] = m_children[i]->m_impl->getValueAs<T>();
         return true;
     }
 
+    template bool PropertyImpl::setArray_PublicApi<float>(const float*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec2f>(const vec2f*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec3f>(const vec3f*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec4f>(const vec4f*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<int32_t>(const int32_t*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<int64_t>(const int64_t*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec2i>(const vec2i*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec3i>(const vec3i*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<vec4i>(const vec4i*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<std::string>(const std::string*, size_t);
+    template bool PropertyImpl::setArray_PublicApi<bool>(const bool*, size_t);
+
+    template bool PropertyImpl::getArray_PublicApi<float>(float*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec2f>(vec2f*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec3f>(vec3f*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec4f>(vec4f*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<int32_t>(int32_t*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<int64_t>(int64_t*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec2i>(vec2i*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec3i>(vec3i*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<vec4i>(vec4i*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<std::string>(std::string*, size_t) const;
+    template bool PropertyImpl::getArray_PublicApi<bool>(bool*, size_t) const;
+
     bool PropertyImpl::bindingInputHasNewValue() const
     {
         // TODO Violin can we make this assert the bindings semantics?
@@ -606,10 +847,41 @@ namespace rlogic::internal
         const bool valueChanged = (m_value != value);
 
         m_value = std::move(value);
+        if (valueChanged)
+            markValueChanged();
 
         return valueChanged;
     }
 
+    bool PropertyImpl::setValueFrom(const PropertyImpl& source)
+    {
+        assert(m_value.index() == source.m_value.index());
+        assert(TypeUtils::IsPrimitiveType(m_typeData.type));
+
+        if (m_semantics == EPropertySemantics::BindingInput)
+        {
+            m_bindingInputHasNewValue = true;
+        }
+
+        if (m_value == source.m_value)
+            return false;
+
+        m_value = source.m_value;
+        markValueChanged();
+        return true;
+    }
+
+    void PropertyImpl::markValueChanged()
+    {
+        if (m_logicNode != nullptr)
+            m_changeGeneration = m_logicNode->markPropertyValueChanged();
+    }
+
+    uint64_t PropertyImpl::getChangeGeneration() const
+    {
+        return m_changeGeneration;
+    }
+
     void PropertyImpl::setPropertyInstance(Property& property)
     {
         assert(m_propertyInstance == nullptr);
@@ -672,51 +944,76 @@ namespace rlogic::internal
 
     bool PropertyImpl::isLinked() const
     {
-        return (m_incomingLink.property != nullptr) || !m_outgoingLinks.empty();
+        return hasIncomingLink() || hasOutgoingLink();
     }
 
     bool PropertyImpl::hasIncomingLink() const
     {
-        return (m_incomingLink.property != nullptr);
+        return m_rareData && (m_rareData->incoming.property != nullptr);
     }
 
     bool PropertyImpl::hasOutgoingLink() const
     {
-        return !m_outgoingLinks.empty();
+        return m_rareData && !m_rareData->outgoing.empty();
     }
 
     const PropertyImpl::Link& PropertyImpl::getIncomingLink() const
     {
         assert(isInput());
-        return m_incomingLink;
+        static const Link NoLink;
+        return m_rareData ? m_rareData->incoming : NoLink;
     }
 
     const std::vector<PropertyImpl::Link>& PropertyImpl::getOutgoingLinks() const
     {
         assert(isOutput());
-        return m_outgoingLinks;
+        static const std::vector<Link> NoLinks;
+        return m_rareData ? m_rareData->outgoing : NoLinks;
     }
 
     void PropertyImpl::setIncomingLink(PropertyImpl& output, bool isWeakLink)
     {
         assert(TypeUtils::IsPrimitiveType(getType()));
         assert(TypeUtils::IsPrimitiveType(output.getType()));
-        assert(m_incomingLink.property == nullptr);
-        assert(std::find_if(output.m_outgoingLinks.begin(), output.m_outgoingLinks.end(), [this](const auto& p) {
-            return p.property == this; }) == output.m_outgoingLinks.end());
+        assert(!hasIncomingLink());
+        assert(std::find_if(output.getOutgoingLinks().begin(), output.getOutgoingLinks().end(), [this](const auto& p) {
+            return p.property == this; }) == output.getOutgoingLinks().end());
+
+        output.getOrCreateRareData().outgoing.push_back({ this, isWeakLink });
+        getOrCreateRareData().incoming = { &output, isWeakLink };
 
-        output.m_outgoingLinks.push_back({ this, isWeakLink });
-        m_incomingLink = { &output, isWeakLink };
+        if (output.m_logicNode != nullptr)
+            output.m_logicNode->invalidateLinkPropagationTable();
     }
 
     void PropertyImpl::resetIncomingLink()
     {
-        assert(isInput() && m_incomingLink.property != nullptr);
-        auto& srcPropertyLinks = m_incomingLink.property->m_outgoingLinks;
+        assert(isInput() && hasIncomingLink());
+        PropertyImpl& source = *m_rareData->incoming.property;
+        auto& srcPropertyLinks = source.m_rareData->outgoing;
         auto linkIter = std::find_if(srcPropertyLinks.begin(), srcPropertyLinks.end(), [this](const auto& p) { return p.property == this; });
         assert(linkIter != srcPropertyLinks.end());
         srcPropertyLinks.erase(linkIter);
-        m_incomingLink = { nullptr, false };
+
+        if (source.m_logicNode != nullptr)
+            source.m_logicNode->invalidateLinkPropagationTable();
+        m_rareData->incoming = { nullptr, false };
+
+        source.releaseRareDataIfUnused();
+        releaseRareDataIfUnused();
+    }
+
+    PropertyImpl::RareData& PropertyImpl::getOrCreateRareData()
+    {
+        if (!m_rareData)
+            m_rareData = std::make_unique<RareData>();
+        return *m_rareData;
+    }
+
+    void PropertyImpl::releaseRareDataIfUnused()
+    {
+        if (m_rareData && m_rareData->incoming.property == nullptr && m_rareData->outgoing.empty() && m_rareData->childNameIndex.empty())
+            m_rareData.reset();
     }
 
     void PropertyImpl::initializeBindingInputValue(PropertyValue value)
@@ -41,6 +41,7 @@ namespace rlogic::internal
 {
     class LogicNodeImpl;
     class ErrorReporting;
+    class FixedSizePool;
 
     using PropertyValue = std::variant<int32_t, int64_t, float, bool, std::string, vec2f, vec3f, vec4f, vec2i, vec3i, vec4i>;
     using PropertyList = std::vector<std::unique_ptr<Property>>;
@@ -63,6 +64,13 @@ namespace rlogic::internal
             DeserializationMap& deserializationMap);
 
 
+        // Properties are created in big numbers (whole property trees of every logic node), while a PropertyPoolScope exists
+        // they are allocated from its pool instead of individually from heap. Can be deleted in any scope.
+        [[nodiscard]] static void* operator new(size_t size);
+        static void operator delete(void* ptr);
+        // Size of pool blocks needed to allocate one property
+        [[nodiscard]] static size_t GetPoolBlockSize();
+
         // Move-able (noexcept); Not copy-able
         ~PropertyImpl() noexcept;
         PropertyImpl& operator=(PropertyImpl&& other) noexcept = default;
@@ -73,6 +81,8 @@ namespace rlogic::internal
         [[nodiscard]] size_t getChildCount() const;
         [[nodiscard]] EPropertyType getType() const;
         [[nodiscard]] std::string_view getName() const;
+        // Type of this property and all its children, e.g. to create property tree of same structure
+        [[nodiscard]] HierarchicalTypeData getHierarchicalTypeData() const;
 
         [[nodiscard]] bool bindingInputHasNewValue() const;
         [[nodiscard]] bool checkForBindingInputNewValueAndReset();
@@ -91,6 +101,8 @@ namespace rlogic::internal
         [[nodiscard]] Property* getChild(std::string_view name);
         [[nodiscard]] const Property* getChild(std::string_view name) const;
         [[nodiscard]] bool hasChild(std::string_view name) const;
+        // Index of struct field with given name, uses hash index for wide structs (see ChildNameIndexThreshold)
+        [[nodiscard]] std::optional<size_t> findChildIndex(std::string_view name) const;
 
         [[nodiscard]] std::vector<const Property*> collectLeafChildren() const;
 
@@ -98,14 +110,29 @@ namespace rlogic::internal
         template <typename T>
         [[nodiscard]] std::optional<T> getValue_PublicApi() const;
         [[nodiscard]] bool setValue_PublicApi(PropertyValue value);
+        // Checks done by setValue_PublicApi, returns error message if user is not allowed to set given value
+        template <typename T>
+        [[nodiscard]] std::optional<std::string> checkValueCanBeSet_PublicApi(const T& value) const;
+        // Sets value which passed checkValueCanBeSet_PublicApi, returns true if owning logic node needs to be set dirty
+        template <typename T>
+        [[nodiscard]] bool setCheckedValue_PublicApi(T value);
+        // Sets/gets values of all elements of array property at once, owning logic node is set dirty at most once
+        template <typename T>
+        [[nodiscard]] bool setArray_PublicApi(const T* values, size_t count);
+        template <typename T>
+        [[nodiscard]] bool getArray_PublicApi(T* values, size_t count) const;
 
         // Generic setter. Can optionally skip dirty-check
         bool setValue(PropertyValue value);
+        // Same as setValue but takes the value from other property, avoids copy if value did not change
+        bool setValueFrom(const PropertyImpl& source);
         // Special setter for binding value init
         void initializeBindingInputValue(PropertyValue value);
 
         // Generic getter for use in other non-template code
         [[nodiscard]] const PropertyValue& getValue() const;
+        // Generation of the update in which the value last changed, 0 if never changed, see LogicEngine::getUpdateGeneration
+        [[nodiscard]] uint64_t getChangeGeneration() const;
         // std::get wrapper for use in template code
         template <typename T>
         [[nodiscard]] const T& getValueAs() const
@@ -139,18 +166,53 @@ namespace rlogic::internal
         PropertyList    m_children;
         PropertyValue   m_value;
 
-        Link m_incomingLink;
-        std::vector<Link> m_outgoingLinks;
+        // Data needed only by few properties (linked ones and wide structs), allocated on demand to keep properties small
+        struct RareData
+        {
+            Link incoming;
+            std::vector<Link> outgoing;
+            // Keys refer to names owned by children, built once after children were created
+            std::unordered_map<std::string_view, size_t> childNameIndex;
+        };
+        std::unique_ptr<RareData> m_rareData;
+
+        // Structs with at least this many fields get a hash index of their field names, smaller ones are scanned linearly
+        static constexpr size_t ChildNameIndexThreshold = 16u;
+        void buildChildNameIndex();
 
         Property* m_propertyInstance = nullptr;
         LogicNodeImpl* m_logicNode = nullptr;
+        uint64_t m_changeGeneration = 0u;
 
         bool m_bindingInputHasNewValue = false;
         EPropertySemantics m_semantics;
 
+        void markValueChanged();
+
+        [[nodiscard]] RareData& getOrCreateRareData();
+        // Frees rare data when property is no longer linked and has no child name index
+        void releaseRareDataIfUnused();
+
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::Property> SerializeRecursive(
             const PropertyImpl& prop,
             flatbuffers::FlatBufferBuilder& builder,
             SerializationMap& serializationMap);
     };
+
+    // Properties created on this thread while an instance exists are allocated from given pool (see PropertyImpl::operator new).
+    // ApiObjects uses it when creating or loading logic nodes, so that their properties are freed together with the ApiObjects.
+    class PropertyPoolScope
+    {
+    public:
+        explicit PropertyPoolScope(FixedSizePool& pool);
+        ~PropertyPoolScope() noexcept;
+
+        PropertyPoolScope(const PropertyPoolScope& other) = delete;
+        PropertyPoolScope(PropertyPoolScope&& other) = delete;
+        PropertyPoolScope& operator=(const PropertyPoolScope& other) = delete;
+        PropertyPoolScope& operator=(PropertyPoolScope&& other) = delete;
+
+    private:
+        FixedSizePool* m_previousPool;
+    };
 }
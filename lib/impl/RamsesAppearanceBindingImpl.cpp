@@ -92,7 +92,7 @@ namespace rlogic::internal
     {
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(binding.m_ramsesAppearance, builder);
 
-        const auto logicObject = LogicObjectImpl::Serialize(binding, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(binding, builder, binding.getUpdateRateDivisor());
         const auto propertyObject = PropertyImpl::Serialize(*binding.getInputs()->m_impl, builder, serializationMap);
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
@@ -178,6 +178,7 @@ namespace rlogic::internal
 
         auto binding = std::make_unique<RamsesAppearanceBindingImpl>(*resolvedAppearance, name, id);
         binding->setUserId(userIdHigh, userIdLow);
+        binding->setUpdateRateDivisor(appearanceBinding.base()->base()->updateRateDivisor());
         binding->setRootInputs(std::make_unique<Property>(std::move(deserializedRootInput)));
 
         return binding;
@@ -41,4 +41,27 @@ namespace rlogic::internal
     {
         setRootProperties(std::move(rootInputs), {});
     }
+
+    void RamsesBindingImpl::clearRamsesStateDependents()
+    {
+        m_ramsesStateDependents.clear();
+    }
+
+    void RamsesBindingImpl::addRamsesStateDependent(LogicNodeImpl& node)
+    {
+        // dependents are collected per node, so duplicates (if any) are added right after each other
+        if (m_ramsesStateDependents.empty() || m_ramsesStateDependents.back() != &node)
+            m_ramsesStateDependents.push_back(&node);
+    }
+
+    const std::vector<LogicNodeImpl*>& RamsesBindingImpl::getRamsesStateDependents() const
+    {
+        return m_ramsesStateDependents;
+    }
+
+    void RamsesBindingImpl::setRamsesStateDependentsDirty()
+    {
+        for (LogicNodeImpl* node : m_ramsesStateDependents)
+            node->setDirty(true);
+    }
 }
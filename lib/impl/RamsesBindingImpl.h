@@ -10,6 +10,8 @@
 
 #include "impl/LogicNodeImpl.h"
 
+#include <vector>
+
 namespace ramses
 {
     class SceneObject;
@@ -33,13 +35,24 @@ namespace rlogic::internal
     public:
         explicit RamsesBindingImpl(std::string_view name, uint64_t id) noexcept;
 
+        // Nodes which read transformation of the bound ramses object (or any of its children) during their update
+        // and thus need to be updated whenever this binding modifies it (see LogicEngine::enableTransformChangeTracking)
+        void clearRamsesStateDependents();
+        void addRamsesStateDependent(LogicNodeImpl& node);
+        [[nodiscard]] const std::vector<LogicNodeImpl*>& getRamsesStateDependents() const;
+
     protected:
         // Used by subclasses to handle serialization
         [[nodiscard]] static flatbuffers::Offset<rlogic_serialization::RamsesReference> SerializeRamsesReference(const ramses::SceneObject& object, flatbuffers::FlatBufferBuilder& builder);
 
         void setRootInputs(std::unique_ptr<Property> rootInputs);
 
+        // To be called by subclasses after the bound ramses object was modified in a way which affects its dependents
+        void setRamsesStateDependentsDirty();
+
     private:
         using LogicNodeImpl::setRootProperties;
+
+        std::vector<LogicNodeImpl*> m_ramsesStateDependents;
     };
 }
@@ -84,7 +84,7 @@ namespace rlogic::internal
     {
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(cameraBinding.m_ramsesCamera, builder);
 
-        const auto logicObject = LogicObjectImpl::Serialize(cameraBinding, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(cameraBinding, builder, cameraBinding.getUpdateRateDivisor());
         const auto propertyObject = PropertyImpl::Serialize(*cameraBinding.getInputs()->m_impl, builder, serializationMap);
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
@@ -165,6 +165,7 @@ namespace rlogic::internal
 
         auto binding = std::make_unique<RamsesCameraBindingImpl>(*resolvedCamera, hasFrustumPlanesProperties, name, id);
         binding->setUserId(userIdHigh, userIdLow);
+        binding->setUpdateRateDivisor(cameraBinding.base()->base()->updateRateDivisor());
         binding->setRootInputs(std::make_unique<Property>(std::move(deserializedRootInput)));
 
         ApplyRamsesValuesToInputProperties(*binding);
@@ -175,6 +176,7 @@ namespace rlogic::internal
     std::optional<LogicNodeRuntimeError> RamsesCameraBindingImpl::update()
     {
         ramses::status_t status = ramses::StatusOK;
+        bool projectionChanged = false;
         PropertyImpl& vpProperties = *getInputs()->getChild(static_cast<size_t>(ECameraPropertyStructStaticIndex::Viewport))->m_impl;
 
         PropertyImpl& vpOffsetX = *vpProperties.getChild(static_cast<size_t>(ECameraViewportPropertyStaticIndex::ViewPortOffsetX))->m_impl;
@@ -202,6 +204,7 @@ namespace rlogic::internal
             {
                 return LogicNodeRuntimeError{m_ramsesCamera.get().getStatusMessage(status)};
             }
+            projectionChanged = true;
         }
 
         PropertyImpl& frustum = *getInputs()->getChild(static_cast<size_t>(ECameraPropertyStructStaticIndex::Frustum))->m_impl;
@@ -234,6 +237,7 @@ namespace rlogic::internal
 
                 if (status != ramses::StatusOK)
                     return LogicNodeRuntimeError{ m_ramsesCamera.get().getStatusMessage(status) };
+                projectionChanged = true;
             }
         }
         else
@@ -252,9 +256,13 @@ namespace rlogic::internal
 
                 if (status != ramses::StatusOK)
                     return LogicNodeRuntimeError{ m_ramsesCamera.get().getStatusMessage(status) };
+                projectionChanged = true;
             }
         }
 
+        if (projectionChanged)
+            setRamsesStateDependentsDirty();
+
         return std::nullopt;
     }
 
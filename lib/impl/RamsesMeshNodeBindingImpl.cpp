@@ -45,7 +45,7 @@ namespace rlogic::internal
         SerializationMap& serializationMap,
         EFeatureLevel /*featureLevel*/)
     {
-        const auto logicObject = LogicObjectImpl::Serialize(meshNodeBinding, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(meshNodeBinding, builder, meshNodeBinding.getUpdateRateDivisor());
         const auto fbRamsesRef = RamsesBindingImpl::SerializeRamsesReference(meshNodeBinding.m_ramsesMeshNode, builder);
         const auto propertyObject = PropertyImpl::Serialize(*meshNodeBinding.getInputs()->m_impl, builder, serializationMap);
         auto fbRamsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
@@ -124,6 +124,7 @@ namespace rlogic::internal
         assert(ramsesMeshNode);
         auto binding = std::make_unique<RamsesMeshNodeBindingImpl>(*ramsesMeshNode, name, id);
         binding->setUserId(userIdHigh, userIdLow);
+        binding->setUpdateRateDivisor(meshNodeBinding.base()->base()->updateRateDivisor());
         binding->setRootInputs(std::make_unique<Property>(std::move(deserializedRootInput)));
 
         ApplyRamsesValuesToInputProperties(*binding, *ramsesMeshNode);
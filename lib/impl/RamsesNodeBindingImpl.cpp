@@ -57,7 +57,7 @@ namespace rlogic::internal
     {
         auto ramsesReference = RamsesBindingImpl::SerializeRamsesReference(nodeBinding.m_ramsesNode, builder);
 
-        const auto logicObject = LogicObjectImpl::Serialize(nodeBinding, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(nodeBinding, builder, nodeBinding.getUpdateRateDivisor());
         const auto propertyObject = PropertyImpl::Serialize(*nodeBinding.getInputs()->m_impl, builder, serializationMap);
         auto ramsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
             logicObject,
@@ -142,6 +142,7 @@ namespace rlogic::internal
 
         auto binding = std::make_unique<RamsesNodeBindingImpl>(*ramsesNode, rotationType, name, id, featureLevel);
         binding->setUserId(userIdHigh, userIdLow);
+        binding->setUpdateRateDivisor(nodeBinding.base()->base()->updateRateDivisor());
         binding->setRootInputs(std::make_unique<Property>(std::move(deserializedRootInput)));
 
         ApplyRamsesValuesToInputProperties(*binding, *ramsesNode, featureLevel);
@@ -184,6 +185,7 @@ namespace rlogic::internal
             }
         }
 
+        bool transformChanged = false;
         PropertyImpl& rotation = *getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Rotation))->m_impl;
         if (rotation.checkForBindingInputNewValueAndReset())
         {
@@ -203,6 +205,7 @@ namespace rlogic::internal
             {
                 return LogicNodeRuntimeError{m_ramsesNode.get().getStatusMessage(status)};
             }
+            transformChanged = true;
         }
 
         PropertyImpl& translation = *getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Translation))->m_impl;
@@ -215,6 +218,7 @@ namespace rlogic::internal
             {
                 return LogicNodeRuntimeError{ m_ramsesNode.get().getStatusMessage(status) };
             }
+            transformChanged = true;
         }
 
         PropertyImpl& scaling = *getInputs()->getChild(static_cast<size_t>(ENodePropertyStaticIndex::Scaling))->m_impl;
@@ -227,8 +231,12 @@ namespace rlogic::internal
             {
                 return LogicNodeRuntimeError{ m_ramsesNode.get().getStatusMessage(status) };
             }
+            transformChanged = true;
         }
 
+        if (transformChanged)
+            setRamsesStateDependentsDirty();
+
         return std::nullopt;
     }
 
@@ -51,7 +51,7 @@ namespace rlogic::internal
         SerializationMap& serializationMap,
         EFeatureLevel /*featureLevel*/)
     {
-        const auto logicObject = LogicObjectImpl::Serialize(renderGroupBinding, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(renderGroupBinding, builder, renderGroupBinding.getUpdateRateDivisor());
         const auto fbRamsesRef = RamsesBindingImpl::SerializeRamsesReference(renderGroupBinding.m_ramsesRenderGroup, builder);
         const auto propertyObject = PropertyImpl::Serialize(*renderGroupBinding.getInputs()->m_impl, builder, serializationMap);
         auto fbRamsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
@@ -167,6 +167,7 @@ namespace rlogic::internal
 
         auto binding = std::make_unique<RamsesRenderGroupBindingImpl>(*ramsesRenderGroup, elements, name, id);
         binding->setUserId(userIdHigh, userIdLow);
+        binding->setUpdateRateDivisor(renderGroupBinding.base()->base()->updateRateDivisor());
         binding->setRootInputs(std::make_unique<Property>(std::move(deserializedRootInput)));
 
         ApplyRamsesValuesToInputProperties(*binding, *ramsesRenderGroup);
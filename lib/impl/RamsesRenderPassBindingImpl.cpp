@@ -49,7 +49,7 @@ namespace rlogic::internal
         SerializationMap& serializationMap,
         EFeatureLevel /*featureLevel*/)
     {
-        const auto logicObject = LogicObjectImpl::Serialize(renderPassBinding, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(renderPassBinding, builder, renderPassBinding.getUpdateRateDivisor());
         const auto fbRamsesRef = RamsesBindingImpl::SerializeRamsesReference(renderPassBinding.m_ramsesRenderPass, builder);
         const auto propertyObject = PropertyImpl::Serialize(*renderPassBinding.getInputs()->m_impl, builder, serializationMap);
         auto fbRamsesBinding = rlogic_serialization::CreateRamsesBinding(builder,
@@ -121,6 +121,7 @@ namespace rlogic::internal
 
         auto binding = std::make_unique<RamsesRenderPassBindingImpl>(*ramsesRenderPass, name, id);
         binding->setUserId(userIdHigh, userIdLow);
+        binding->setUpdateRateDivisor(renderPassBinding.base()->base()->updateRateDivisor());
         binding->setRootInputs(std::make_unique<Property>(std::move(deserializedRootInput)));
 
         ApplyRamsesValuesToInputProperties(*binding, *ramsesRenderPass);
@@ -60,7 +60,7 @@ namespace rlogic::internal
         SerializationMap& /*serializationMap*/,
         EFeatureLevel /*featureLevel*/)
     {
-        const auto fbLogicObject = LogicObjectImpl::Serialize(skinBinding, builder);
+        const auto fbLogicObject = LogicObjectImpl::Serialize(skinBinding, builder, skinBinding.getUpdateRateDivisor());
 
         std::vector<uint64_t> jointIds;
         jointIds.reserve(skinBinding.m_joints.size());
@@ -151,6 +151,7 @@ namespace rlogic::internal
 
         auto binding = std::make_unique<SkinBindingImpl>(joints, inverseMats, *appearanceBinding, jointMatInput, name, id);
         binding->setUserId(userIdHigh, userIdLow);
+        binding->setUpdateRateDivisor(skinBinding.base()->updateRateDivisor());
         binding->setRootInputs({});
 
         return binding;
@@ -36,6 +36,11 @@ namespace rlogic::internal
         setRootProperties(std::make_unique<Property>(std::move(inputsImpl)), std::make_unique<Property>(std::move(outputsImpl)));
     }
 
+    bool TimerNodeImpl::canUpdateConcurrently() const
+    {
+        return true;
+    }
+
     std::optional<LogicNodeRuntimeError> TimerNodeImpl::update()
     {
         const int64_t ticker = *getInputs()->getChild(0u)->get<int64_t>();
@@ -72,7 +77,7 @@ namespace rlogic::internal
         timerNode.getOutputs()->getChild(0u)->m_impl->setValue(int64_t(0));
 
         // 3. Serialize
-        const auto logicObject = LogicObjectImpl::Serialize(timerNode, builder);
+        const auto logicObject = LogicObjectImpl::Serialize(timerNode, builder, timerNode.getUpdateRateDivisor());
         const auto inputPropertyObject = PropertyImpl::Serialize(*timerNode.getInputs()->m_impl, builder, serializationMap);
         const auto outputPropertyObject = PropertyImpl::Serialize(*timerNode.getOutputs()->m_impl, builder, serializationMap);
         auto timerNodeOffset = rlogic_serialization::CreateTimerNode(
@@ -105,6 +110,7 @@ namespace rlogic::internal
 
         auto deserialized = std::make_unique<TimerNodeImpl>(name, id);
         deserialized->setUserId(userIdHigh, userIdLow);
+        deserialized->setUpdateRateDivisor(timerNodeFB.base()->updateRateDivisor());
 
         // deserialize and overwrite constructor generated properties
         auto rootInProperty = PropertyImpl::Deserialize(*timerNodeFB.rootInput(), EPropertySemantics::ScriptInput, errorReporting, deserializationMap);
@@ -37,6 +37,7 @@ namespace rlogic::internal
         TimerNodeImpl(std::string_view name, uint64_t id) noexcept;
 
         std::optional<LogicNodeRuntimeError> update() override;
+        [[nodiscard]] bool canUpdateConcurrently() const override;
 
         void createRootProperties() final;
 
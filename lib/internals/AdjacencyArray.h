@@ -0,0 +1,112 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    // Stores many small lists (e.g. edges of graph nodes, indexed by node index) in one contiguous array, similar
+    // to the compressed sparse row format but modifiable. Each list occupies a slice of the array with some spare capacity,
+    // when a slice is full it is moved to the end of the array with doubled capacity. Thanks to the doubling the abandoned
+    // slices never take more space than the current slices. Memory is never given back though: neither abandoned slices nor
+    // capacity freed by erase() or clear() is reused by other lists, the array only shrinks when destroyed. This suits graphs
+    // whose edges change rarely compared to how often they are iterated.
+    // Pointers returned by begin/end are invalidated by push() to any list.
+    template <typename T>
+    class AdjacencyArray
+    {
+    public:
+        // Makes sure there is a (possibly empty) list for every index < listCount
+        void resize(size_t listCount)
+        {
+            if (listCount > m_lists.size())
+                m_lists.resize(listCount);
+        }
+
+        [[nodiscard]] size_t size(size_t list) const
+        {
+            return m_lists[list].size;
+        }
+
+        [[nodiscard]] const T* begin(size_t list) const
+        {
+            return m_elements.data() + m_lists[list].offset;
+        }
+
+        [[nodiscard]] const T* end(size_t list) const
+        {
+            return begin(list) + m_lists[list].size;
+        }
+
+        [[nodiscard]] T* begin(size_t list)
+        {
+            return m_elements.data() + m_lists[list].offset;
+        }
+
+        [[nodiscard]] T* end(size_t list)
+        {
+            return begin(list) + m_lists[list].size;
+        }
+
+        void push(size_t list, const T& element)
+        {
+            if (m_lists[list].size == m_lists[list].capacity)
+                grow(list);
+
+            Slice& slice = m_lists[list];
+            m_elements[slice.offset + slice.size] = element;
+            ++slice.size;
+        }
+
+        // Keeps relative order of the remaining elements
+        void erase(size_t list, const T* element)
+        {
+            T* first = begin(list);
+            assert(element >= first && element < end(list));
+            T* position = first + (element - first);
+            std::move(position + 1, end(list), position);
+            --m_lists[list].size;
+        }
+
+        // Capacity of the list is kept for reuse
+        void clear(size_t list)
+        {
+            m_lists[list].size = 0u;
+        }
+
+    private:
+        struct Slice
+        {
+            size_t offset = 0u;
+            size_t size = 0u;
+            size_t capacity = 0u;
+        };
+
+        static constexpr size_t MinCapacity = 4u;
+
+        void grow(size_t list)
+        {
+            Slice& slice = m_lists[list];
+            const size_t newCapacity = std::max(slice.capacity * 2u, MinCapacity);
+            const size_t newOffset = m_elements.size();
+            m_elements.resize(newOffset + newCapacity);
+            std::move(m_elements.begin() + static_cast<std::ptrdiff_t>(slice.offset), m_elements.begin() + static_cast<std::ptrdiff_t>(slice.offset + slice.size), m_elements.begin() + static_cast<std::ptrdiff_t>(newOffset));
+
+            slice.offset = newOffset;
+            slice.capacity = newCapacity;
+        }
+
+        std::vector<T> m_elements;
+        std::vector<Slice> m_lists;
+    };
+}
@@ -70,9 +70,11 @@
 
 namespace rlogic::internal
 {
-    ApiObjects::ApiObjects(EFeatureLevel featureLevel)
-        : m_featureLevel{ featureLevel }
+    ApiObjects::ApiObjects(EFeatureLevel featureLevel, size_t luaStateCount)
+        : m_propertyPool{ PropertyImpl::GetPoolBlockSize(), 1024u }
+        , m_featureLevel{ featureLevel }
     {
+        setLuaStateCount(luaStateCount);
     }
 
     ApiObjects::~ApiObjects() noexcept = default;
@@ -98,12 +100,17 @@ namespace rlogic::internal
         std::string_view scriptName,
         ErrorReporting& errorReporting)
     {
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         const ModuleMapping& modules = config.getModuleMapping();
         if (!checkLuaModules(modules, errorReporting))
             return nullptr;
 
+        SolState* solState = prepareSolStateForNextScript(modules, errorReporting);
+        if (!solState)
+            return nullptr;
+
         std::optional<LuaCompiledScript> compiledScript = LuaCompilationUtils::CompileScriptOrImportPrecompiled(
-            *m_solState,
+            *solState,
             modules,
             config.getStandardModules(),
             std::string{ source },
@@ -121,6 +128,56 @@ namespace rlogic::internal
         m_scripts.push_back(script);
         registerLogicObject(std::move(up));
         script->m_impl.createRootProperties();
+        script->m_script.enableConcurrentUpdate(m_solStates.size() > 1u);
+        advanceScriptSolState();
+
+        return script;
+    }
+
+    LuaScript* ApiObjects::createLuaScriptInstance(
+        const LuaScript& prototype,
+        std::string_view scriptName,
+        ErrorReporting& errorReporting)
+    {
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
+        if (m_scripts.cend() == std::find(m_scripts.cbegin(), m_scripts.cend(), &prototype))
+        {
+            errorReporting.add(fmt::format("Failed to create instance of LuaScript '{}'! It was created on a different instance of LogicEngine.", prototype.getName()), &prototype, EErrorType::IllegalArgument);
+            return nullptr;
+        }
+
+        const LuaScriptImpl& prototypeImpl = prototype.m_script;
+        const ModuleMapping& modules = prototypeImpl.getModules();
+        SolState* solState = prepareSolStateForNextScript(modules, errorReporting);
+        if (!solState)
+            return nullptr;
+
+        // instance loads byte code of prototype (if available) into its own environment and gets property tree
+        // of same type, i.e. neither source parsing nor interface extraction is needed
+        const std::shared_ptr<const LuaScriptCode>& code = prototypeImpl.getCode();
+        std::optional<LuaCompiledScript> compiledScript = LuaCompilationUtils::CompileScriptOrImportPrecompiled(
+            *solState,
+            modules,
+            prototypeImpl.getStandardModules(),
+            code->source,
+            scriptName,
+            errorReporting,
+            code->byteCode,
+            std::make_unique<Property>(std::make_unique<PropertyImpl>(prototype.getInputs()->m_impl->getHierarchicalTypeData(), EPropertySemantics::ScriptInput)),
+            std::make_unique<Property>(std::make_unique<PropertyImpl>(prototype.getOutputs()->m_impl->getHierarchicalTypeData(), EPropertySemantics::ScriptOutput)),
+            m_featureLevel,
+            prototypeImpl.hasDebugLogFunctions());
+
+        if (!compiledScript)
+            return nullptr;
+
+        std::unique_ptr<LuaScript> up = std::make_unique<LuaScript>(std::make_unique<LuaScriptImpl>(std::move(*compiledScript), scriptName, getNextLogicObjectId(), code));
+        LuaScript* script = up.get();
+        m_scripts.push_back(script);
+        registerLogicObject(std::move(up));
+        script->m_impl.createRootProperties();
+        script->m_script.enableConcurrentUpdate(m_solStates.size() > 1u);
+        advanceScriptSolState();
 
         return script;
     }
@@ -132,6 +189,7 @@ namespace rlogic::internal
         ErrorReporting& errorReporting,
         bool verifyModules)
     {
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         if (interfaceName.empty())
         {
             errorReporting.add("Can't create interface with empty name!", nullptr, EErrorType::IllegalArgument);
@@ -143,7 +201,7 @@ namespace rlogic::internal
             return nullptr;
 
         std::optional<LuaCompiledInterface> compiledInterface = LuaCompilationUtils::CompileInterface(
-            *m_solState,
+            getPrimarySolState(),
             modules,
             config.getStandardModules(),
             verifyModules,
@@ -172,7 +230,7 @@ namespace rlogic::internal
             return nullptr;
 
         std::optional<LuaCompiledModule> compiledModule = LuaCompilationUtils::CompileModuleOrImportPrecompiled(
-            *m_solState,
+            getPrimarySolState(),
             modules,
             config.getStandardModules(),
             std::string{source},
@@ -195,6 +253,7 @@ namespace rlogic::internal
 
     RamsesNodeBinding* ApiObjects::createRamsesNodeBinding(ramses::Node& ramsesNode, ERotationType rotationType, std::string_view name)
     {
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<RamsesNodeBinding> up = std::make_unique<RamsesNodeBinding>(std::make_unique<RamsesNodeBindingImpl>(ramsesNode, rotationType, name, getNextLogicObjectId(), m_featureLevel));
         RamsesNodeBinding* binding = up.get();
         m_ramsesNodeBindings.push_back(binding);
@@ -206,6 +265,7 @@ namespace rlogic::internal
 
     RamsesAppearanceBinding* ApiObjects::createRamsesAppearanceBinding(ramses::Appearance& ramsesAppearance, std::string_view name)
     {
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<RamsesAppearanceBinding> up = std::make_unique<RamsesAppearanceBinding>(std::make_unique<RamsesAppearanceBindingImpl>(ramsesAppearance, name, getNextLogicObjectId()));
         RamsesAppearanceBinding* binding = up.get();
         m_ramsesAppearanceBindings.push_back(binding);
@@ -217,6 +277,7 @@ namespace rlogic::internal
 
     RamsesCameraBinding* ApiObjects::createRamsesCameraBinding(ramses::Camera& ramsesCamera, bool withFrustumPlanes, std::string_view name)
     {
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<RamsesCameraBinding> up = std::make_unique<RamsesCameraBinding>(std::make_unique<RamsesCameraBindingImpl>(ramsesCamera, withFrustumPlanes, name, getNextLogicObjectId()));
         RamsesCameraBinding* binding = up.get();
         m_ramsesCameraBindings.push_back(binding);
@@ -229,6 +290,7 @@ namespace rlogic::internal
     RamsesRenderPassBinding* ApiObjects::createRamsesRenderPassBinding(ramses::RenderPass& ramsesRenderPass, std::string_view name)
     {
         assert(m_featureLevel >= EFeatureLevel_02);
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<RamsesRenderPassBinding> up = std::make_unique<RamsesRenderPassBinding>(std::make_unique<RamsesRenderPassBindingImpl>(ramsesRenderPass, name, getNextLogicObjectId()));
         RamsesRenderPassBinding* binding = up.get();
         m_ramsesRenderPassBindings.push_back(binding);
@@ -241,6 +303,7 @@ namespace rlogic::internal
     RamsesRenderGroupBinding* ApiObjects::createRamsesRenderGroupBinding(ramses::RenderGroup& ramsesRenderGroup, const RamsesRenderGroupBindingElements& elements, std::string_view name)
     {
         assert(m_featureLevel >= EFeatureLevel_03);
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<RamsesRenderGroupBinding> up = std::make_unique<RamsesRenderGroupBinding>(std::make_unique<RamsesRenderGroupBindingImpl>(ramsesRenderGroup, *elements.m_impl, name, getNextLogicObjectId()));
         RamsesRenderGroupBinding* binding = up.get();
         m_ramsesRenderGroupBindings.push_back(binding);
@@ -253,6 +316,7 @@ namespace rlogic::internal
     RamsesMeshNodeBinding* ApiObjects::createRamsesMeshNodeBinding(ramses::MeshNode& ramsesMeshNode, std::string_view name)
     {
         assert(m_featureLevel >= EFeatureLevel_05);
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         auto up = std::make_unique<RamsesMeshNodeBinding>(std::make_unique<RamsesMeshNodeBindingImpl>(ramsesMeshNode, name, getNextLogicObjectId()));
         RamsesMeshNodeBinding* binding = up.get();
         m_ramsesMeshNodeBindings.push_back(binding);
@@ -270,6 +334,7 @@ namespace rlogic::internal
         std::string_view name)
     {
         assert(m_featureLevel >= EFeatureLevel_04);
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<SkinBinding> up = std::make_unique<SkinBinding>(std::make_unique<SkinBindingImpl>(std::move(joints), inverseBindMatrices, appearanceBinding, jointMatInput, name, getNextLogicObjectId()));
         SkinBinding* binding = up.get();
         m_skinBindings.push_back(binding);
@@ -295,6 +360,7 @@ namespace rlogic::internal
 
     AnimationNode* ApiObjects::createAnimationNode(const AnimationNodeConfigImpl& config, std::string_view name)
     {
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<AnimationNode> up = std::make_unique<AnimationNode>(
             std::make_unique<AnimationNodeImpl>(config.getChannels(), config.getExposingOfChannelDataAsProperties(), name, getNextLogicObjectId()));
         AnimationNode* animation = up.get();
@@ -307,6 +373,7 @@ namespace rlogic::internal
 
     TimerNode* ApiObjects::createTimerNode(std::string_view name)
     {
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<TimerNode> up = std::make_unique<TimerNode>(std::make_unique<TimerNodeImpl>(name, getNextLogicObjectId()));
         TimerNode* timer = up.get();
         m_timerNodes.push_back(timer);
@@ -319,6 +386,7 @@ namespace rlogic::internal
     AnchorPoint* ApiObjects::createAnchorPoint(RamsesNodeBindingImpl& nodeBinding, RamsesCameraBindingImpl& cameraBinding, std::string_view name)
     {
         assert(m_featureLevel >= EFeatureLevel_02);
+        PropertyPoolScope propertyPoolScope{ m_propertyPool };
         std::unique_ptr<AnchorPoint> up = std::make_unique<AnchorPoint>(std::make_unique<AnchorPointImpl>(nodeBinding, cameraBinding, name, getNextLogicObjectId()));
         AnchorPoint* anchor = up.get();
         m_anchorPoints.push_back(anchor);
@@ -335,6 +403,7 @@ namespace rlogic::internal
     {
         m_reverseImplMapping.emplace(std::make_pair(&logicNode.m_impl, &logicNode));
         m_logicNodeDependencies.addNode(logicNode.m_impl);
+        logicNode.m_impl.setUpdateGenerationCounter(&m_updateGeneration);
     }
 
     void ApiObjects::unregisterLogicNode(LogicNode& logicNode)
@@ -345,6 +414,7 @@ namespace rlogic::internal
         m_reverseImplMapping.erase(implIter);
 
         m_logicNodeDependencies.removeNode(logicNodeImpl);
+        logicNodeImpl.setUpdateGenerationCounter(nullptr);
     }
 
     bool ApiObjects::destroy(LogicObject& object, ErrorReporting& errorReporting)
@@ -1025,6 +1095,11 @@ namespace rlogic::internal
         return m_reverseImplMapping;
     }
 
+    const FixedSizePool& ApiObjects::getPropertyPool() const
+    {
+        return m_propertyPool;
+    }
+
     flatbuffers::Offset<rlogic_serialization::ApiObjects> ApiObjects::Serialize(const ApiObjects& apiObjects, flatbuffers::FlatBufferBuilder& builder, ELuaSavingMode luaSavingMode)
     {
         SerializationMap serializationMap;
@@ -1187,10 +1262,14 @@ namespace rlogic::internal
         const IRamsesObjectResolver* ramsesResolver,
         const std::string& dataSourceDescription,
         ErrorReporting& errorReporting,
-        EFeatureLevel featureLevel)
+        EFeatureLevel featureLevel,
+        size_t luaStateCount,
+        bool sharedCompilationCache)
     {
         // Collect data here, only return if no error occurred
-        auto deserialized = std::make_unique<ApiObjects>(featureLevel);
+        auto deserialized = std::make_unique<ApiObjects>(featureLevel, luaStateCount);
+        deserialized->enableSharedCompilationCache(sharedCompilationCache);
+        PropertyPoolScope propertyPoolScope{ deserialized->m_propertyPool };
 
         // Collect deserialized object mappings to resolve dependencies
         DeserializationMap deserializationMap;
@@ -1310,7 +1389,7 @@ namespace rlogic::internal
         deserialized->m_luaModules.reserve(luaModules.size());
         for (const auto* module : luaModules)
         {
-            std::unique_ptr<LuaModuleImpl> deserializedModule = LuaModuleImpl::Deserialize(*deserialized->m_solState, *module, errorReporting, deserializationMap, featureLevel);
+            std::unique_ptr<LuaModuleImpl> deserializedModule = LuaModuleImpl::Deserialize(deserialized->getPrimarySolState(), *module, errorReporting, deserializationMap, featureLevel);
             if (!deserializedModule)
                 return nullptr;
 
@@ -1328,14 +1407,34 @@ namespace rlogic::internal
             // TODO Violin find ways to unit-test this case - also for other container types
             // Ideas: see if verifier catches it; or: disable flatbuffer's internal asserts if possible
             assert (script);
-            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(*deserialized->m_solState, *script, errorReporting, deserializationMap, featureLevel);
+            SolState* solState = &deserialized->getPrimarySolState();
+            if (deserialized->m_solStates.size() > 1u)
+            {
+                // modules used by script must be loaded in its Lua state before the script is compiled
+                ModuleMapping modulesUsed;
+                if (script->userModules())
+                {
+                    for (const auto* module : *script->userModules())
+                    {
+                        const auto* moduleUsed = deserializationMap.resolveLogicObject<LuaModuleImpl>(module->moduleId());
+                        if (module->name() && moduleUsed)
+                            modulesUsed.emplace(module->name()->str(), moduleUsed->getLogicObject().as<LuaModule>());
+                    }
+                }
+                solState = deserialized->prepareSolStateForNextScript(modulesUsed, errorReporting);
+                if (!solState)
+                    return nullptr;
+            }
+            std::unique_ptr<LuaScriptImpl> deserializedScript = LuaScriptImpl::Deserialize(*solState, *script, errorReporting, deserializationMap, featureLevel);
 
             if (deserializedScript)
             {
+                deserializedScript->enableConcurrentUpdate(deserialized->m_solStates.size() > 1u);
                 std::unique_ptr<LuaScript> up             = std::make_unique<LuaScript>(std::move(deserializedScript));
                 LuaScript*                 luascript = up.get();
                 deserialized->m_scripts.push_back(luascript);
                 deserialized->registerLogicObject(std::move(up));
+                deserialized->advanceScriptSolState();
             }
             else
             {
@@ -1672,9 +1771,84 @@ namespace rlogic::internal
         return ++m_lastObjectId;
     }
 
+    uint64_t ApiObjects::getUpdateGeneration() const
+    {
+        return m_updateGeneration;
+    }
+
+    void ApiObjects::setUpdateGeneration(uint64_t generation)
+    {
+        m_updateGeneration = generation;
+    }
+
     int ApiObjects::getNumElementsInLuaStack() const
     {
-        return m_solState->getNumElementsInLuaStack();
+        int numElements = 0;
+        for (const auto& solState : m_solStates)
+            numElements += solState->getNumElementsInLuaStack();
+        return numElements;
+    }
+
+    void ApiObjects::setLuaStateCount(size_t luaStateCount)
+    {
+        assert(luaStateCount > 0u);
+        assert(m_scripts.empty() && m_interfaces.empty() && m_luaModules.empty());
+        m_solStates.clear();
+        m_solStates.reserve(luaStateCount);
+        for (size_t i = 0u; i < luaStateCount; ++i)
+        {
+            m_solStates.push_back(std::make_unique<SolState>());
+            m_solStates.back()->enableSharedCompilationCache(m_sharedCompilationCacheEnabled);
+        }
+        m_nextScriptSolState = 0u;
+    }
+
+    void ApiObjects::enableSharedCompilationCache(bool enabled)
+    {
+        m_sharedCompilationCacheEnabled = enabled;
+        for (const auto& solState : m_solStates)
+            solState->enableSharedCompilationCache(enabled);
+    }
+
+    bool ApiObjects::isSharedCompilationCacheEnabled() const
+    {
+        return m_sharedCompilationCacheEnabled;
+    }
+
+    size_t ApiObjects::getLuaStateCount() const
+    {
+        return m_solStates.size();
+    }
+
+    const std::vector<std::unique_ptr<SolState>>& ApiObjects::getSolStates() const
+    {
+        return m_solStates;
+    }
+
+    SolState& ApiObjects::getPrimarySolState()
+    {
+        return *m_solStates.front();
+    }
+
+    SolState* ApiObjects::prepareSolStateForNextScript(const ModuleMapping& modules, ErrorReporting& errorReporting)
+    {
+        SolState& solState = *m_solStates[m_nextScriptSolState];
+
+        for (const auto& module : modules)
+        {
+            if (!module.second->m_impl.loadIntoSolState(solState, m_featureLevel, errorReporting))
+            {
+                errorReporting.add(fmt::format("Failed to load Lua module '{}' into Lua state of script!", module.first), module.second, EErrorType::Other);
+                return nullptr;
+            }
+        }
+
+        return &solState;
+    }
+
+    void ApiObjects::advanceScriptSolState()
+    {
+        m_nextScriptSolState = (m_nextScriptSolState + 1u) % m_solStates.size();
     }
 
     const std::vector<PropertyLink>& ApiObjects::getAllPropertyLinks() const
@@ -20,6 +20,7 @@
 #include "internals/LuaCompilationUtils.h"
 #include "internals/SolState.h"
 #include "internals/LogicNodeDependencies.h"
+#include "internals/FixedSizePool.h"
 
 #include <vector>
 #include <memory>
@@ -88,7 +89,7 @@ namespace rlogic::internal
     {
     public:
         // Not move-able and non-copyable
-        explicit ApiObjects(EFeatureLevel featureLevel);
+        explicit ApiObjects(EFeatureLevel featureLevel, size_t luaStateCount = 1u);
         ~ApiObjects() noexcept;
         // Not move-able because of the dependency between sol objects and their parent sol state
         // Moving those would require a custom move assignment operator which keeps both sol states alive
@@ -114,7 +115,9 @@ namespace rlogic::internal
             const IRamsesObjectResolver* ramsesResolver,
             const std::string& dataSourceDescription,
             ErrorReporting& errorReporting,
-            EFeatureLevel featureLevel);
+            EFeatureLevel featureLevel,
+            size_t luaStateCount = 1u,
+            bool sharedCompilationCache = false);
 
         // Create/destroy API objects
         LuaScript* createLuaScript(
@@ -122,6 +125,10 @@ namespace rlogic::internal
             const LuaConfigImpl& config,
             std::string_view scriptName,
             ErrorReporting& errorReporting);
+        LuaScript* createLuaScriptInstance(
+            const LuaScript& prototype,
+            std::string_view scriptName,
+            ErrorReporting& errorReporting);
         LuaInterface* createLuaInterface(
             std::string_view source,
             const LuaConfigImpl& config,
@@ -172,12 +179,27 @@ namespace rlogic::internal
         // Internally used
         [[nodiscard]] bool bindingsDirty() const;
         [[nodiscard]] uint64_t getNextLogicObjectId();
+        // Number of updates executed so far, logic nodes use it to stamp changed property values (see LogicNodeImpl::markPropertyValueChanged)
+        [[nodiscard]] uint64_t getUpdateGeneration() const;
+        void setUpdateGeneration(uint64_t generation);
 
         // Strictly for testing purposes (inverse mappings require extra attention and test coverage)
         [[nodiscard]] const std::unordered_map<LogicNodeImpl*, LogicNode*>& getReverseImplMapping() const;
+        [[nodiscard]] const FixedSizePool& getPropertyPool() const;
 
         [[nodiscard]] int getNumElementsInLuaStack() const;
 
+        // Scripts are distributed over given number of Lua states in order of creation, so that scripts in different states
+        // can be executed concurrently. Modules and interfaces are created in the first state, modules are loaded into other
+        // states when a script in that state uses them. Can be changed only while there are no Lua objects.
+        void setLuaStateCount(size_t luaStateCount);
+        [[nodiscard]] size_t getLuaStateCount() const;
+        [[nodiscard]] const std::vector<std::unique_ptr<SolState>>& getSolStates() const;
+
+        // Scripts and modules created/loaded afterwards use process-wide LuaCompilationCache
+        void enableSharedCompilationCache(bool enabled);
+        [[nodiscard]] bool isSharedCompilationCacheEnabled() const;
+
         [[nodiscard]] const std::vector<PropertyLink>& getAllPropertyLinks() const;
 
     private:
@@ -209,7 +231,19 @@ namespace rlogic::internal
 
         std::vector<PropertyLink> collectPropertyLinks() const;
 
-        std::unique_ptr<SolState> m_solState {std::make_unique<SolState>()};
+        [[nodiscard]] SolState& getPrimarySolState();
+        // Next Lua state in round-robin order, with given modules loaded into it
+        [[nodiscard]] SolState* prepareSolStateForNextScript(const ModuleMapping& modules, ErrorReporting& errorReporting);
+        // Moves on to next Lua state, called only once a script was created in the state, so that failures don't skip states
+        void advanceScriptSolState();
+
+        // Properties of all logic nodes are allocated from here (see PropertyPoolScope), declared first so that
+        // it is destroyed after all objects and their properties
+        FixedSizePool m_propertyPool;
+
+        std::vector<std::unique_ptr<SolState>> m_solStates;
+        size_t m_nextScriptSolState = 0u;
+        bool m_sharedCompilationCacheEnabled = false;
 
         ApiObjectContainer<LuaScript>                m_scripts;
         ApiObjectContainer<LuaInterface>             m_interfaces;
@@ -230,6 +264,7 @@ namespace rlogic::internal
 
         LogicNodeDependencies                        m_logicNodeDependencies;
         uint64_t                                     m_lastObjectId = 0;
+        uint64_t                                     m_updateGeneration = 0;
 
         std::unordered_map<LogicNodeImpl*, LogicNode*> m_reverseImplMapping;
         std::unordered_map<uint64_t, LogicObject*>     m_logicObjectIdMapping;
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <unordered_map>
+#include <memory>
 
 namespace rlogic_serialization
 {
@@ -25,6 +26,7 @@ namespace rlogic::internal
 {
     class PropertyImpl;
     class LogicObjectImpl;
+    struct LuaScriptCode;
 
     // Remembers flatbuffers pointers to deserialized objects temporarily during deserialization
     class DeserializationMap
@@ -67,6 +69,21 @@ namespace rlogic::internal
             return nullptr;
         }
 
+        // serialized code is flatbuffers source or byte code of script, shared by instances of same script
+        void storeLuaScriptCode(const void* serializedCode, std::shared_ptr<const LuaScriptCode> code)
+        {
+            m_luaScriptCodes.emplace(serializedCode, std::move(code));
+        }
+
+        [[nodiscard]] std::shared_ptr<const LuaScriptCode> resolveLuaScriptCodeIfFound(const void* serializedCode) const
+        {
+            const auto it = m_luaScriptCodes.find(serializedCode);
+            if (it != m_luaScriptCodes.cend())
+                return it->second;
+
+            return nullptr;
+        }
+
     private:
         template <typename Key, typename Value>
         static void Store(Key key, Value value, std::unordered_map<Key, Value>& container)
@@ -87,6 +104,7 @@ namespace rlogic::internal
         std::unordered_map<const rlogic_serialization::Property*, PropertyImpl*> m_properties;
         std::unordered_map<const rlogic_serialization::DataArray*, const DataArray*> m_dataArrays;
         std::unordered_map<uint64_t, LogicObjectImpl*> m_logicObjects;
+        std::unordered_map<const void*, std::shared_ptr<const LuaScriptCode>> m_luaScriptCodes;
     };
 
 }
@@ -8,153 +8,356 @@
 
 #include "internals/DirectedAcyclicGraph.h"
 
+#include "impl/LogicNodeImpl.h"
+
 #include <cassert>
 #include <algorithm>
-#include <unordered_set>
 #include <numeric>
-#include <iterator>
 
 namespace rlogic::internal
 {
     void DirectedAcyclicGraph::addNode(Node& node)
     {
-        assert(m_nodeOutgoingEdges.count(&node) == 0);
-        assert(m_nodeIncomingEdges.count(&node) == 0);
-        m_nodeOutgoingEdges.insert({ &node, {} });
-        m_nodeIncomingEdges.insert({ &node, {} });
+        assert(node.getGraphIndex() == Node::InvalidGraphIndex);
+
+        size_t nodeIdx = m_nodes.size();
+        if (m_freeNodeIndices.empty())
+        {
+            m_nodes.push_back(&node);
+            m_nodeRanks.push_back(0u);
+            m_visitMarks.push_back(0u);
+            m_predecessors.push_back(0u);
+            m_outgoingEdges.resize(m_nodes.size());
+            m_incomingEdges.resize(m_nodes.size());
+        }
+        else
+        {
+            nodeIdx = m_freeNodeIndices.back();
+            m_freeNodeIndices.pop_back();
+            assert(m_nodes[nodeIdx] == nullptr);
+            m_nodes[nodeIdx] = &node;
+        }
+        node.setGraphIndex(nodeIdx);
+
+        // node without edges can be put anywhere, append it so that ranks of other nodes are kept
+        m_topologicalOrder.push_back(nodeIdx);
+        m_nodeRanks[nodeIdx] = m_topologicalOrder.size() - 1u;
+        ++m_orderRevision;
+        ++m_structureRevision;
     }
 
     void DirectedAcyclicGraph::removeNode(Node& nodeToRemove)
     {
-        assert(m_nodeOutgoingEdges.count(&nodeToRemove) != 0);
-        assert(m_nodeIncomingEdges.count(&nodeToRemove) != 0);
+        assert(containsNode(nodeToRemove));
+        const size_t nodeIdx = nodeToRemove.getGraphIndex();
 
         // remove node from all edge lists pointing to it from source nodes
-        const auto srcNodesIt = m_nodeIncomingEdges.find(&nodeToRemove);
-        for (const auto srcNode : srcNodesIt->second)
-        {
-            EdgeList& srcNodeOutgoingEdges = m_nodeOutgoingEdges.find(srcNode)->second;
-            const auto it = std::remove_if(srcNodeOutgoingEdges.begin(), srcNodeOutgoingEdges.end(),
-                [&nodeToRemove](const auto& e) { return e.target == &nodeToRemove; });
-            srcNodeOutgoingEdges.erase(it, srcNodeOutgoingEdges.end());
-        }
+        for (const size_t* srcNode = m_incomingEdges.begin(nodeIdx); srcNode != m_incomingEdges.end(nodeIdx); ++srcNode)
+            m_outgoingEdges.erase(*srcNode, findEdge(*srcNode, nodeIdx));
 
         // remove node from all edge lists pointing to it from its target nodes
-        const auto tgtNodesIt = m_nodeOutgoingEdges.find(&nodeToRemove);
-        for (const auto& tgtNode : tgtNodesIt->second)
+        for (const Edge* edge = m_outgoingEdges.begin(nodeIdx); edge != m_outgoingEdges.end(nodeIdx); ++edge)
+            m_incomingEdges.erase(edge->target, std::find(m_incomingEdges.begin(edge->target), m_incomingEdges.end(edge->target), nodeIdx));
+
+        m_incomingEdges.clear(nodeIdx);
+        m_outgoingEdges.clear(nodeIdx);
+        m_nodes[nodeIdx] = nullptr;
+        m_freeNodeIndices.push_back(nodeIdx);
+        nodeToRemove.setGraphIndex(Node::InvalidGraphIndex);
+
+        // removing a node keeps relative order of remaining nodes valid, leave a gap instead of shifting ranks of all nodes after it
+        m_topologicalOrder[m_nodeRanks[nodeIdx]] = RemovedNode;
+        ++m_removedNodeCount;
+        if (2u * m_removedNodeCount >= m_topologicalOrder.size())
+            compactOrder();
+        ++m_orderRevision;
+        ++m_structureRevision;
+    }
+
+    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes()
+    {
+        if (!m_orderValid)
+        {
+            // incremental order maintenance failed before because of a cycle, try to sort from scratch
+            std::optional<std::vector<size_t>> sortedNodes = sortAllNodes();
+            if (!sortedNodes)
+                return std::nullopt;
+
+            m_topologicalOrder = std::move(*sortedNodes);
+            for (size_t rank = 0u; rank < m_topologicalOrder.size(); ++rank)
+                assignRank(m_topologicalOrder[rank], rank);
+            m_removedNodeCount = 0u;
+            m_orderValid = true;
+            ++m_orderRevision;
+        }
+        else if (m_removedNodeCount > 0u)
         {
-            auto& tgtNodeEdges = m_nodeIncomingEdges.find(tgtNode.target)->second;
-            tgtNodeEdges.erase(std::find(tgtNodeEdges.begin(), tgtNodeEdges.end(), &nodeToRemove));
+            compactOrder();
         }
 
-        // remove node from both maps
-        m_nodeIncomingEdges.erase(srcNodesIt);
-        m_nodeOutgoingEdges.erase(&nodeToRemove);
+        NodeVector sortedNodes;
+        sortedNodes.reserve(m_topologicalOrder.size());
+        for (const size_t nodeIdx : m_topologicalOrder)
+            sortedNodes.push_back(m_nodes[nodeIdx]);
+
+        return sortedNodes;
     }
 
-    // This is a slightly exotic sorting algorithm for DAGs
-    // It works based on these general principles:
-    // - Traverse the DAG starting from the root nodes
-    // - Keep the nodes in a sparsely sorted queue (with more slots than actual nodes, and some empty slots)
-    // - Any time a new 'edge' is traversed, moves the 'target' node of the edge to the last position of the queue
-    // - If number of iterations exceeds N^2, there was a loop in the graph -> abort
-    // This is supposed to work fast, because the queue is never re-allocated or re-sorted, only grows incrementally, and
-    // we only need to run a second time and remove the 'empty slots' to get the final order.
-    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes() const
+    uint64_t DirectedAcyclicGraph::getTopologicalOrderRevision() const
     {
-        const size_t totalNodeCount = m_nodeOutgoingEdges.size();
+        return m_orderRevision;
+    }
 
-        // This remembers temporarily the position of node N in 'nodeQueue' (see below)
-        // This index can change in different loops of the code below
-        std::unordered_map<const Node*, size_t> nodeIndexIntoQueue;
-        nodeIndexIntoQueue.reserve(totalNodeCount);
+    uint64_t DirectedAcyclicGraph::getStructureRevision() const
+    {
+        return m_structureRevision;
+    }
 
-        // This is a queue of nodes which is:
-        // - partially sorted (at any given time during the loops, the first X entries are sorted, while the rest is not sorted yet)
-        // - sparse (some entries can be nullptr) - of nodes which were moved during the algorithm, see below
-        // - sorted at the end of the loop (by their topological rank)
-        // - starts with the root nodes (they are always at the beginning)
-        NodeVector sparseNodeQueue = collectRootNodes();
+    NodeVector DirectedAcyclicGraph::findPath(Node& from, Node& to) const
+    {
+        assert(containsNode(from));
+        assert(containsNode(to));
+        const size_t fromIdx = from.getGraphIndex();
+        const size_t toIdx = to.getGraphIndex();
+
+        // with valid order only nodes ranked between 'from' and 'to' can be on the path
+        const size_t maxRank = m_orderValid ? m_nodeRanks[toIdx] : m_topologicalOrder.size();
+        if (m_orderValid && m_nodeRanks[fromIdx] > maxRank)
+            return {};
+
+        // breadth-first search remembering the predecessor of each visited node, finds one of the shortest paths
+        beginTraversal();
+        markVisited(fromIdx);
+        std::vector<size_t> nodesToVisit{ fromIdx };
+        for (size_t i = 0u; i < nodesToVisit.size(); ++i)
+        {
+            const size_t nodeIdx = nodesToVisit[i];
+            if (nodeIdx == toIdx)
+            {
+                NodeVector path{ m_nodes[toIdx] };
+                for (size_t pathNode = toIdx; pathNode != fromIdx; pathNode = m_predecessors[pathNode])
+                    path.push_back(m_nodes[m_predecessors[pathNode]]);
+                std::reverse(path.begin(), path.end());
+                return path;
+            }
+
+            for (const Edge* edge = m_outgoingEdges.begin(nodeIdx); edge != m_outgoingEdges.end(nodeIdx); ++edge)
+            {
+                if (m_nodeRanks[edge->target] <= maxRank && markVisited(edge->target))
+                {
+                    m_predecessors[edge->target] = nodeIdx;
+                    nodesToVisit.push_back(edge->target);
+                }
+            }
+        }
+
+        return {};
+    }
 
-        // Cycle condition - can't find root nodes among a non-empty set of nodes
-        if (sparseNodeQueue.empty() && !m_nodeOutgoingEdges.empty())
+    std::vector<size_t> DirectedAcyclicGraph::getUpstreamNodeRanks(const NodeVector& nodes) const
+    {
+        assert(m_orderValid && m_removedNodeCount == 0u);
+
+        beginTraversal();
+        std::vector<size_t> nodesToVisit;
+        for (const Node* node : nodes)
         {
-            return std::nullopt;
+            assert(containsNode(*node));
+            if (markVisited(node->getGraphIndex()))
+                nodesToVisit.push_back(node->getGraphIndex());
         }
 
-        // sparseNodeQueue grows here all the time
-        // TODO Violin rework algorithm to not grow and loop over the same container
-        for (size_t i = 0; i < sparseNodeQueue.size(); ++i)
+        std::vector<size_t> ranks;
+        while (!nodesToVisit.empty())
         {
-            if (i > totalNodeCount * totalNodeCount)
+            const size_t nodeIdx = nodesToVisit.back();
+            nodesToVisit.pop_back();
+            ranks.push_back(m_nodeRanks[nodeIdx]);
+
+            for (const size_t* srcNode = m_incomingEdges.begin(nodeIdx); srcNode != m_incomingEdges.end(nodeIdx); ++srcNode)
             {
-                // TODO Violin this is a primitive loop detection. Replace with a proper graph-based solution!
-                // The inner and the outer loop are bound by N(number of nodes), so exceeding that is a
-                // sufficient condition that there was a loop
-                return std::nullopt;
+                if (markVisited(*srcNode))
+                    nodesToVisit.push_back(*srcNode);
             }
+        }
 
-            // Get the next node in the queue and process based on its outgoing edges
-            Node* nextNode = sparseNodeQueue[i];
-            // sparseNodeQueue has nullptr holes - skip those
-            if (nextNode != nullptr)
-            {
-                const EdgeList& nextNodeEdges = m_nodeOutgoingEdges.find(nextNode)->second;
+        std::sort(ranks.begin(), ranks.end());
+        return ranks;
+    }
 
-                // For each edge, put the 'target' node to the end of the queue (this order may be temporarily wrong,
-                // because we don't know if those nodes have also edges between them which would affect this order)
-                // What happens if it's wrong? see the if() inside the loop
-                for (const auto& outgoingEdge : nextNodeEdges)
+    void DirectedAcyclicGraph::restoreOrderAfterNewEdge(size_t source, size_t target)
+    {
+        const size_t lowerRank = m_nodeRanks[target];
+        const size_t upperRank = m_nodeRanks[source];
+        // order is not affected by the new edge
+        if (upperRank < lowerRank)
+            return;
+
+        // Only nodes with rank between target and source need to be reordered (Pearce-Kelly):
+        // nodes reachable from target must be moved after nodes from which source is reachable
+        std::vector<size_t> forwardNodes;
+        if (!collectNodesInRankRange(target, true, lowerRank, upperRank, forwardNodes))
+        {
+            // source reachable from target -> new edge closes a cycle
+            m_orderValid = false;
+            ++m_orderRevision;
+            return;
+        }
+        std::vector<size_t> backwardNodes;
+        const bool noCycle = collectNodesInRankRange(source, false, lowerRank, upperRank, backwardNodes);
+        assert(noCycle);
+        (void)noCycle;
+
+        const auto byRank = [this](size_t n1, size_t n2) { return m_nodeRanks[n1] < m_nodeRanks[n2]; };
+        std::sort(forwardNodes.begin(), forwardNodes.end(), byRank);
+        std::sort(backwardNodes.begin(), backwardNodes.end(), byRank);
+
+        // reuse the ranks occupied by affected nodes, assign the lower ones to backward nodes keeping their relative order
+        std::vector<size_t> freeRanks;
+        freeRanks.reserve(forwardNodes.size() + backwardNodes.size());
+        for (const size_t node : backwardNodes)
+            freeRanks.push_back(m_nodeRanks[node]);
+        for (const size_t node : forwardNodes)
+            freeRanks.push_back(m_nodeRanks[node]);
+        std::sort(freeRanks.begin(), freeRanks.end());
+
+        auto rankIt = freeRanks.cbegin();
+        for (const size_t node : backwardNodes)
+            assignRank(node, *rankIt++);
+        for (const size_t node : forwardNodes)
+            assignRank(node, *rankIt++);
+
+        ++m_orderRevision;
+    }
+
+    bool DirectedAcyclicGraph::collectNodesInRankRange(size_t startNode, bool forward, size_t lowerRank, size_t upperRank, std::vector<size_t>& collectedNodes) const
+    {
+        beginTraversal();
+        markVisited(startNode);
+        collectedNodes.push_back(startNode);
+
+        const auto visitNode = [&](size_t node) {
+            const size_t rank = m_nodeRanks[node];
+            if (rank == lowerRank || rank == upperRank)
+                return false;
+            if (rank > lowerRank && rank < upperRank && markVisited(node))
+                collectedNodes.push_back(node);
+            return true;
+        };
+
+        // collectedNodes grows while being iterated, each collected node is visited once
+        for (size_t i = 0u; i < collectedNodes.size(); ++i)
+        {
+            const size_t node = collectedNodes[i];
+            if (forward)
+            {
+                for (const Edge* edge = m_outgoingEdges.begin(node); edge != m_outgoingEdges.end(node); ++edge)
                 {
-                    // Put the node at the end of the 'sparseNodeQueue' and remember the index
-                    Node* outgoingEdgeTarget = outgoingEdge.target;
-                    sparseNodeQueue.emplace_back(outgoingEdgeTarget);
-                    const size_t targetNodeIndex = sparseNodeQueue.size() - 1;
-
-                    const auto potentiallyAlreadyProcessedNode = nodeIndexIntoQueue.find(outgoingEdgeTarget);
-                    // target node not processed yet?
-                    if (potentiallyAlreadyProcessedNode == nodeIndexIntoQueue.end())
-                    {
-                        // => insert to processed queue, with current index from 'queue'
-                        nodeIndexIntoQueue.insert({ outgoingEdgeTarget, targetNodeIndex });
-                    }
-                    // target node processed already?
-                    else
-                    {
-                        // => move the node from its last computed index to the current one
-                        // (and set to nullptr on its last position so that it does not occur twice in the queue)
-                        // Why do we do this? Because it makes sure that any time there is a 'new edge' to a node,
-                        // it is moved to the last position in the queue, unless it has no 'incoming edges' (root node)
-                        // or it has exactly one incoming edge (and never needs to be re-sorted)
-                        sparseNodeQueue[potentiallyAlreadyProcessedNode->second] = nullptr;
-                        potentiallyAlreadyProcessedNode->second = targetNodeIndex;
-                    }
+                    if (!visitNode(edge->target))
+                        return false;
                 }
             }
+            else
+            {
+                for (const size_t* srcNode = m_incomingEdges.begin(node); srcNode != m_incomingEdges.end(node); ++srcNode)
+                {
+                    if (!visitNode(*srcNode))
+                        return false;
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void DirectedAcyclicGraph::assignRank(size_t node, size_t rank)
+    {
+        m_topologicalOrder[rank] = node;
+        m_nodeRanks[node] = rank;
+    }
+
+    void DirectedAcyclicGraph::compactOrder()
+    {
+        m_topologicalOrder.erase(std::remove(m_topologicalOrder.begin(), m_topologicalOrder.end(), RemovedNode), m_topologicalOrder.end());
+        for (size_t rank = 0u; rank < m_topologicalOrder.size(); ++rank)
+            m_nodeRanks[m_topologicalOrder[rank]] = rank;
+        m_removedNodeCount = 0u;
+    }
+
+    // Kahn's algorithm, runs in O(V+E) and detects cycles (nodes in a cycle never get rid of their incoming edges).
+    // Root nodes are collected in their current order, so that order of unrelated nodes is kept where possible.
+    std::optional<std::vector<size_t>> DirectedAcyclicGraph::sortAllNodes() const
+    {
+        std::vector<size_t> remainingInDegrees(m_nodes.size(), 0u);
+
+        std::vector<size_t> sortedNodes;
+        sortedNodes.reserve(m_topologicalOrder.size() - m_removedNodeCount);
+        for (const size_t node : m_topologicalOrder)
+        {
+            if (node == RemovedNode)
+                continue;
+            remainingInDegrees[node] = m_incomingEdges.size(node);
+            if (remainingInDegrees[node] == 0u)
+                sortedNodes.push_back(node);
+        }
+
+        // sortedNodes grows while being iterated, any node is appended once all its source nodes were processed
+        for (size_t i = 0u; i < sortedNodes.size(); ++i)
+        {
+            const size_t node = sortedNodes[i];
+            for (const Edge* edge = m_outgoingEdges.begin(node); edge != m_outgoingEdges.end(node); ++edge)
+            {
+                assert(remainingInDegrees[edge->target] > 0u);
+                if (--remainingInDegrees[edge->target] == 0u)
+                    sortedNodes.push_back(edge->target);
+            }
         }
 
-        // Some nodes are nullptr because of the special 'bubble sort' sorting method
-        sparseNodeQueue.erase(std::remove(sparseNodeQueue.begin(), sparseNodeQueue.end(), nullptr), sparseNodeQueue.end());
+        if (sortedNodes.size() != m_topologicalOrder.size() - m_removedNodeCount)
+            return std::nullopt;
 
-        return sparseNodeQueue;
+        return sortedNodes;
+    }
+
+    std::vector<size_t> DirectedAcyclicGraph::getTopologicalLevels(const NodeVector& sortedNodes) const
+    {
+        std::vector<size_t> nodeLevels(m_nodes.size(), 0u);
+
+        std::vector<size_t> levels(sortedNodes.size(), 0u);
+        for (size_t rank = 0u; rank < sortedNodes.size(); ++rank)
+        {
+            // all source nodes precede the node in sorted order, so their level is known already
+            const size_t nodeIdx = sortedNodes[rank]->getGraphIndex();
+            size_t level = 0u;
+            for (const size_t* srcNode = m_incomingEdges.begin(nodeIdx); srcNode != m_incomingEdges.end(nodeIdx); ++srcNode)
+                level = std::max(level, nodeLevels[*srcNode] + 1u);
+
+            nodeLevels[nodeIdx] = level;
+            levels[rank] = level;
+        }
+
+        return levels;
     }
 
     bool DirectedAcyclicGraph::addEdge(Node& source, Node& target)
     {
-        assert(m_nodeOutgoingEdges.count(&source) != 0);
-        assert(m_nodeOutgoingEdges.count(&target) != 0);
-        assert(m_nodeIncomingEdges.count(&source) != 0);
-        assert(m_nodeIncomingEdges.count(&target) != 0);
+        assert(containsNode(source));
+        assert(containsNode(target));
+        const size_t sourceIdx = source.getGraphIndex();
+        const size_t targetIdx = target.getGraphIndex();
 
-        auto& nodeEdges = m_nodeOutgoingEdges.find(&source)->second;
-        auto edgeBetweenNodes = FindEdgeToNode(nodeEdges, target);
-        const bool isNewConnection = (edgeBetweenNodes == nodeEdges.end());
+        Edge* edgeBetweenNodes = findEdge(sourceIdx, targetIdx);
+        const bool isNewConnection = (edgeBetweenNodes == nullptr);
         if (isNewConnection)
         {
-            nodeEdges.push_back({ &target, 1u });
-            auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
-            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) == tgtToSourcesList.cend());
-            tgtToSourcesList.push_back(&source);
+            m_outgoingEdges.push(sourceIdx, { targetIdx, 1u });
+            assert(std::find(m_incomingEdges.begin(targetIdx), m_incomingEdges.end(targetIdx), sourceIdx) == m_incomingEdges.end(targetIdx));
+            m_incomingEdges.push(targetIdx, sourceIdx);
+            ++m_structureRevision;
+
+            // if order is already invalid (cycle), new edge can't make it valid again
+            if (m_orderValid)
+                restoreOrderAfterNewEdge(sourceIdx, targetIdx);
         }
         else
         {
@@ -166,38 +369,40 @@ namespace rlogic::internal
 
     void DirectedAcyclicGraph::removeEdge(Node& source, Node& target)
     {
-        assert(m_nodeOutgoingEdges.count(&source) != 0);
-        assert(m_nodeOutgoingEdges.count(&target) != 0);
-        assert(m_nodeIncomingEdges.count(&source) != 0);
-        assert(m_nodeIncomingEdges.count(&target) != 0);
+        assert(containsNode(source));
+        assert(containsNode(target));
+        const size_t sourceIdx = source.getGraphIndex();
+        const size_t targetIdx = target.getGraphIndex();
 
-        auto& srcNodeEdges = m_nodeOutgoingEdges.find(&source)->second;
-        auto outgoingEdge = FindEdgeToNode(srcNodeEdges, target);
-        assert(outgoingEdge != srcNodeEdges.end());
+        Edge* outgoingEdge = findEdge(sourceIdx, targetIdx);
+        assert(outgoingEdge != nullptr);
         assert(outgoingEdge->multiplicity > 0u);
         --outgoingEdge->multiplicity;
         if (outgoingEdge->multiplicity == 0)
         {
-            srcNodeEdges.erase(outgoingEdge);
-            auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
-            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) != tgtToSourcesList.cend());
-            tgtToSourcesList.erase(std::find(tgtToSourcesList.begin(), tgtToSourcesList.end(), &source));
+            m_outgoingEdges.erase(sourceIdx, outgoingEdge);
+            const size_t* incomingEdge = std::find(m_incomingEdges.begin(targetIdx), m_incomingEdges.end(targetIdx), sourceIdx);
+            assert(incomingEdge != m_incomingEdges.end(targetIdx));
+            m_incomingEdges.erase(targetIdx, incomingEdge);
+            ++m_structureRevision;
+
+            // removing an edge never invalidates a valid order, but it may have broken a cycle
+            if (!m_orderValid)
+                ++m_orderRevision;
         }
     }
 
     size_t DirectedAcyclicGraph::getInDegree(Node& node) const
     {
-        assert(m_nodeOutgoingEdges.count(&node) != 0);
-        assert(m_nodeIncomingEdges.count(&node) != 0);
+        assert(containsNode(node));
+        const size_t nodeIdx = node.getGraphIndex();
 
         size_t edgeCount = 0u;
-        const auto srcNodesList = m_nodeIncomingEdges.find(&node)->second;
-        for (const auto srcNode : srcNodesList)
+        for (const size_t* srcNode = m_incomingEdges.begin(nodeIdx); srcNode != m_incomingEdges.end(nodeIdx); ++srcNode)
         {
-            const EdgeList& srcNodeOutgoingEdges = m_nodeOutgoingEdges.find(srcNode)->second;
-            const auto edgeIt = FindEdgeToNode(srcNodeOutgoingEdges, node);
-            assert(edgeIt != srcNodeOutgoingEdges.cend());
-            edgeCount += edgeIt->multiplicity;
+            const Edge* edge = findEdge(*srcNode, nodeIdx);
+            assert(edge != nullptr);
+            edgeCount += edge->multiplicity;
         }
 
         return edgeCount;
@@ -206,39 +411,40 @@ namespace rlogic::internal
     size_t DirectedAcyclicGraph::getOutDegree(Node& node) const
     {
         assert(containsNode(node));
-        const auto it = m_nodeOutgoingEdges.find(&node);
-        return std::accumulate(it->second.cbegin(), it->second.cend(), size_t(0u), [](size_t sum, const Edge& e) {
+        const size_t nodeIdx = node.getGraphIndex();
+        return std::accumulate(m_outgoingEdges.begin(nodeIdx), m_outgoingEdges.end(nodeIdx), size_t(0u), [](size_t sum, const Edge& e) {
             return sum + e.multiplicity;
         });
     }
 
-    NodeVector DirectedAcyclicGraph::collectRootNodes() const
+    bool DirectedAcyclicGraph::containsNode(const Node& node) const
     {
-        NodeVector rootNodes;
-        // reserve to all nodes count because it will be used to store all sorted nodes later
-        rootNodes.reserve(m_nodeIncomingEdges.size());
-
-        for (const auto& nodeIngoingEdges : m_nodeIncomingEdges)
-        {
-            if (nodeIngoingEdges.second.empty())
-                rootNodes.push_back(nodeIngoingEdges.first);
-        }
+        const size_t nodeIdx = node.getGraphIndex();
+        return nodeIdx < m_nodes.size() && m_nodes[nodeIdx] == &node;
+    }
 
-        return rootNodes;
+    const DirectedAcyclicGraph::Edge* DirectedAcyclicGraph::findEdge(size_t source, size_t target) const
+    {
+        const Edge* edge = std::find_if(m_outgoingEdges.begin(source), m_outgoingEdges.end(source), [target](const Edge& e) { return e.target == target; });
+        return edge != m_outgoingEdges.end(source) ? edge : nullptr;
     }
 
-    bool DirectedAcyclicGraph::containsNode(Node& node) const
+    DirectedAcyclicGraph::Edge* DirectedAcyclicGraph::findEdge(size_t source, size_t target)
     {
-        return m_nodeOutgoingEdges.find(&node) != m_nodeOutgoingEdges.end();
+        Edge* edge = std::find_if(m_outgoingEdges.begin(source), m_outgoingEdges.end(source), [target](const Edge& e) { return e.target == target; });
+        return edge != m_outgoingEdges.end(source) ? edge : nullptr;
     }
 
-    DirectedAcyclicGraph::EdgeList::const_iterator DirectedAcyclicGraph::FindEdgeToNode(const EdgeList& vec, const Node& node)
+    void DirectedAcyclicGraph::beginTraversal() const
     {
-        return std::find_if(vec.begin(), vec.end(), [&node](const auto& e) { return e.target == &node; });
+        ++m_traversalId;
     }
 
-    DirectedAcyclicGraph::EdgeList::iterator DirectedAcyclicGraph::FindEdgeToNode(EdgeList& vec, const Node& node)
+    bool DirectedAcyclicGraph::markVisited(size_t node) const
     {
-        return std::find_if(vec.begin(), vec.end(), [&node](const auto& e) { return e.target == &node; });
+        if (m_visitMarks[node] == m_traversalId)
+            return false;
+        m_visitMarks[node] = m_traversalId;
+        return true;
     }
 }
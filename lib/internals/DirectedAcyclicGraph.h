@@ -8,15 +8,15 @@
 
 #pragma once
 
+#include "internals/AdjacencyArray.h"
+
 #include <vector>
 #include <optional>
-#include <unordered_map>
 #include <cstdint>
+#include <limits>
 
 namespace rlogic::internal
 {
-    // We don't depend on any functionality of LogicNodeImpl here, just using the
-    // pointer as a unique identifier of the node
     class LogicNodeImpl;
 
     // TODO narrow down the scope of this typedef
@@ -30,8 +30,14 @@ namespace rlogic::internal
     // number of total links of node properties to other nodes' properties, i.e. if two nodes A and B have three connected
     // properties, and node A and C have two connected properties, then addEdge(A, B) will have been called 3 times,
     // addEdge(A, C) two times, and A will have outDegree=5.
-    // Topological sort result is cached because it's sensitive for performance (and is only
-    // executed once before update()
+    // Topological order of the nodes is maintained incrementally (Pearce-Kelly algorithm): adding an edge which
+    // contradicts the current order only reorders the nodes between its source and target (by their current rank),
+    // removing edges or nodes never invalidates the order. Only when an added edge closes a cycle the order is marked
+    // invalid and recomputed from scratch once the graph is sortable again.
+    // A removed node leaves a gap in the order instead of shifting the ranks of all nodes after it. Gaps are closed in one
+    // pass when sorted nodes are requested or when they make up half of the order, so removing N nodes takes O(N) in total.
+    // Each node gets a dense index when added (stored in the node, indices of removed nodes are reused), all per-node
+    // data and edges are stored in arrays indexed by it, so that graph algorithms don't need to hash node pointers.
     class DirectedAcyclicGraph
     {
     public:
@@ -40,12 +46,30 @@ namespace rlogic::internal
 
         void addNode(Node& node);
         void removeNode(Node& node);
-        [[nodiscard]] bool containsNode(Node& node) const;
+        [[nodiscard]] bool containsNode(const Node& node) const;
 
         bool addEdge(Node& source, Node& target);
         void removeEdge(Node& source, Node& target);
 
-        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes() const;
+        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes();
+        // Changes whenever the topological order (potentially) changed, i.e. the result of getTopologicallySortedNodes
+        // is guaranteed to be same as long as this value does not change
+        [[nodiscard]] uint64_t getTopologicalOrderRevision() const;
+        // Changes whenever a node or an edge (not just its multiplicity) was added or removed, also if the order stays same,
+        // i.e. data derived from the graph structure like topological levels is valid as long as this value does not change
+        [[nodiscard]] uint64_t getStructureRevision() const;
+
+        // Returns nodes on a shortest path from 'from' to 'to' (both included) or empty vector if 'to' is not reachable.
+        // Used to check if a new edge would close a cycle, i.e. edge A->B closes a cycle if there is a path from B to A.
+        [[nodiscard]] NodeVector findPath(Node& from, Node& to) const;
+
+        // Returns ranks (positions in topologically sorted nodes) of given nodes and of all nodes from which any of them
+        // is reachable, in ascending order. Only valid to call when sorted nodes are available (getTopologicallySortedNodes succeeded).
+        [[nodiscard]] std::vector<size_t> getUpstreamNodeRanks(const NodeVector& nodes) const;
+
+        // Returns level of each of topologically sorted nodes (indexed by rank), where level of a node is the length of the longest
+        // path leading to it (i.e. root nodes are in level 0). There are no edges between nodes of the same level.
+        [[nodiscard]] std::vector<size_t> getTopologicalLevels(const NodeVector& sortedNodes) const;
 
         // For testing only
         [[nodiscard]] size_t getInDegree(Node& node) const;
@@ -54,23 +78,50 @@ namespace rlogic::internal
     private:
         struct Edge
         {
-            Node* target = nullptr;
+            size_t target = 0u;
             size_t multiplicity = 0u;
         };
-        using EdgeList = std::vector<Edge>;
 
-        NodeVector collectRootNodes() const;
+        [[nodiscard]] std::optional<std::vector<size_t>> sortAllNodes() const;
 
-        static EdgeList::const_iterator FindEdgeToNode(const EdgeList& vec, const Node& node);
-        static EdgeList::iterator FindEdgeToNode(EdgeList& vec, const Node& node);
+        // Reorders nodes affected by new edge source->target if it contradicts the current order, marks order invalid if edge closes a cycle
+        void restoreOrderAfterNewEdge(size_t source, size_t target);
+        // Collects nodes reachable from given start node (in or against edge direction) whose rank is within given bounds,
+        // returns false if a node with rank equal to one of the bounds was reached (i.e. there is a cycle)
+        [[nodiscard]] bool collectNodesInRankRange(size_t startNode, bool forward, size_t lowerRank, size_t upperRank, std::vector<size_t>& collectedNodes) const;
+        void assignRank(size_t node, size_t rank);
+        // Closes gaps left by removed nodes in the order, ranks of remaining nodes become dense again
+        void compactOrder();
 
-        // Stores both nodes and their edges in one hashmap
-        // If a node has no outgoing links, the 'EdgeList' is empty
-        // Each entry in 'EdgeList' represents an edge to another node
+        [[nodiscard]] const Edge* findEdge(size_t source, size_t target) const;
+        [[nodiscard]] Edge* findEdge(size_t source, size_t target);
+        // Starts new traversal, after this no node is marked visited
+        void beginTraversal() const;
+        // Marks node visited in current traversal, returns false if it was visited already
+        bool markVisited(size_t node) const;
+
+        // Nodes by their index, nullptr for unused indices (listed in m_freeNodeIndices)
+        NodeVector m_nodes;
+        std::vector<size_t> m_freeNodeIndices;
 
         // Edges from source node to target nodes (edge can have more than 1 instance represented by multiplicity)
-        std::unordered_map<Node*, EdgeList> m_nodeOutgoingEdges;
+        AdjacencyArray<Edge> m_outgoingEdges;
         // Reverse relation from target node to all its source nodes (here without keeping edge multiplicity count)
-        std::unordered_map<Node*, NodeVector> m_nodeIncomingEdges;
+        AdjacencyArray<size_t> m_incomingEdges;
+
+        // Node indices in topological order (only if m_orderValid) and reverse mapping from node index to its position (rank)
+        // Removed nodes are left in the order as RemovedNode until it is compacted
+        static constexpr size_t RemovedNode = std::numeric_limits<size_t>::max();
+        std::vector<size_t> m_topologicalOrder;
+        std::vector<size_t> m_nodeRanks;
+        size_t m_removedNodeCount = 0u;
+        bool m_orderValid = true;
+        uint64_t m_orderRevision = 0u;
+        uint64_t m_structureRevision = 0u;
+
+        // Scratch data for graph traversals, node was visited in current traversal if its mark equals m_traversalId
+        mutable std::vector<uint64_t> m_visitMarks;
+        mutable std::vector<size_t> m_predecessors;
+        mutable uint64_t m_traversalId = 0u;
     };
 }
@@ -0,0 +1,127 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/DirtyNodeWorklist.h"
+
+#include "impl/LogicNodeImpl.h"
+
+#include <cassert>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        size_t FindLowestSetBit(uint64_t word)
+        {
+            assert(word != 0u);
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_ctzll(word));
+#else
+            size_t bit = 0u;
+            while ((word & 1u) == 0u)
+            {
+                word >>= 1u;
+                ++bit;
+            }
+            return bit;
+#endif
+        }
+
+        size_t CountSetBits(uint64_t word)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return static_cast<size_t>(__builtin_popcountll(word));
+#else
+            size_t count = 0u;
+            for (; word != 0u; word &= word - 1u)
+                ++count;
+            return count;
+#endif
+        }
+    }
+
+    void DirtyNodeWorklist::reset(const NodeVector& sortedNodes)
+    {
+        m_rankCount = sortedNodes.size();
+        m_markedRanks.assign((m_rankCount + BitsPerWord - 1u) / BitsPerWord, 0u);
+
+        for (size_t rank = 0u; rank < sortedNodes.size(); ++rank)
+        {
+            LogicNodeImpl& node = *sortedNodes[rank];
+            node.setDirtyWorklist(this, rank);
+            if (node.isDirty())
+                mark(rank);
+        }
+    }
+
+    void DirtyNodeWorklist::mark(size_t rank)
+    {
+        if (rank >= m_rankCount)
+            return;
+
+        uint64_t& word = m_markedRanks[rank / BitsPerWord];
+        const uint64_t bit = uint64_t(1u) << (rank % BitsPerWord);
+        if (m_newMarks != nullptr && (word & bit) == 0u)
+            m_newMarks->push_back(rank);
+        word |= bit;
+    }
+
+    void DirtyNodeWorklist::unmark(size_t rank)
+    {
+        if (rank < m_rankCount)
+            m_markedRanks[rank / BitsPerWord] &= ~(uint64_t(1u) << (rank % BitsPerWord));
+    }
+
+    size_t DirtyNodeWorklist::findNextMarked(size_t fromRank) const
+    {
+        if (fromRank >= m_rankCount)
+            return InvalidRank;
+
+        size_t wordIdx = fromRank / BitsPerWord;
+        // ignore marks below fromRank in the first word
+        uint64_t word = m_markedRanks[wordIdx] & (~uint64_t(0u) << (fromRank % BitsPerWord));
+        while (word == 0u)
+        {
+            if (++wordIdx == m_markedRanks.size())
+                return InvalidRank;
+            word = m_markedRanks[wordIdx];
+        }
+
+        return wordIdx * BitsPerWord + FindLowestSetBit(word);
+    }
+
+    size_t DirtyNodeWorklist::popNextMarked(size_t fromRank)
+    {
+        const size_t rank = findNextMarked(fromRank);
+        unmark(rank);
+        return rank;
+    }
+
+    void DirtyNodeWorklist::setNewMarksLog(std::vector<size_t>* newMarks)
+    {
+        m_newMarks = newMarks;
+    }
+
+    bool DirtyNodeWorklist::isMarked(size_t rank) const
+    {
+        return rank < m_rankCount && (m_markedRanks[rank / BitsPerWord] & (uint64_t(1u) << (rank % BitsPerWord))) != 0u;
+    }
+
+    size_t DirtyNodeWorklist::countMarked(size_t fromRank) const
+    {
+        if (fromRank >= m_rankCount)
+            return 0u;
+
+        size_t wordIdx = fromRank / BitsPerWord;
+        size_t count = CountSetBits(m_markedRanks[wordIdx] & (~uint64_t(0u) << (fromRank % BitsPerWord)));
+        for (++wordIdx; wordIdx < m_markedRanks.size(); ++wordIdx)
+            count += CountSetBits(m_markedRanks[wordIdx]);
+
+        return count;
+    }
+}
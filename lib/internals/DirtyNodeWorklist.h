@@ -0,0 +1,55 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "internals/DirectedAcyclicGraph.h"
+
+#include <vector>
+#include <limits>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    // Keeps track of logic nodes which were set dirty, as a bitset indexed by topological rank of the nodes
+    // (i.e. their position in the topologically sorted node list). This allows update() to visit dirty nodes in
+    // topological order with cost proportional to the number of dirty nodes rather than to the number of all nodes.
+    // Nodes mark and unmark themselves when their dirtiness changes (see LogicNodeImpl::setDirty), update may additionally
+    // unmark a rank before it resets the node, e.g. while it visits dirty nodes (see popNextMarked).
+    class DirtyNodeWorklist
+    {
+    public:
+        static constexpr size_t InvalidRank = std::numeric_limits<size_t>::max();
+
+        // Assigns ranks to given nodes (and attaches them to this worklist) and marks those which are currently dirty
+        void reset(const NodeVector& sortedNodes);
+
+        // Ranks out of range are ignored, that can happen for nodes whose rank was not assigned yet
+        void mark(size_t rank);
+        void unmark(size_t rank);
+
+        // Returns the lowest marked rank which is >= fromRank, InvalidRank if there is none
+        [[nodiscard]] size_t findNextMarked(size_t fromRank) const;
+        // Same as findNextMarked, but also unmarks the found rank
+        [[nodiscard]] size_t popNextMarked(size_t fromRank);
+
+        // While log is set, ranks which were not marked before are appended to it when marked (nullptr stops logging)
+        void setNewMarksLog(std::vector<size_t>* newMarks);
+
+        [[nodiscard]] bool isMarked(size_t rank) const;
+        // Number of marked ranks which are >= fromRank
+        [[nodiscard]] size_t countMarked(size_t fromRank) const;
+
+    private:
+        static constexpr size_t BitsPerWord = 64u;
+
+        std::vector<uint64_t> m_markedRanks;
+        size_t m_rankCount = 0u;
+        std::vector<size_t>* m_newMarks = nullptr;
+    };
+}
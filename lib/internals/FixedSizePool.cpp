@@ -0,0 +1,65 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/FixedSizePool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <new>
+
+namespace rlogic::internal
+{
+    FixedSizePool::FixedSizePool(size_t blockSize, size_t blocksPerChunk)
+        // keep every block aligned as if allocated by operator new, free blocks must be able to hold the free list link
+        : m_blockSize{ (std::max(blockSize, sizeof(FreeBlock)) + alignof(std::max_align_t) - 1u) / alignof(std::max_align_t) * alignof(std::max_align_t) }
+        , m_blocksPerChunk{ blocksPerChunk }
+    {
+        assert(m_blocksPerChunk > 0u);
+    }
+
+    void* FixedSizePool::allocate()
+    {
+        if (m_freeBlocks != nullptr)
+        {
+            FreeBlock* block = m_freeBlocks;
+            m_freeBlocks = block->next;
+            ++m_usedBlocks;
+            return block;
+        }
+
+        if (m_chunks.empty() || m_nextUntouchedBlock == m_blocksPerChunk)
+        {
+            // not value-initialized, blocks are raw storage
+            std::unique_ptr<std::byte[]> chunk{ new std::byte[m_blockSize * m_blocksPerChunk] };
+            m_chunks.push_back(std::move(chunk));
+            m_nextUntouchedBlock = 0u;
+        }
+
+        ++m_usedBlocks;
+        return m_chunks.back().get() + m_blockSize * m_nextUntouchedBlock++;
+    }
+
+    void FixedSizePool::deallocate(void* block)
+    {
+        assert(m_usedBlocks > 0u);
+        --m_usedBlocks;
+
+        FreeBlock* freeBlock = new (block) FreeBlock{ m_freeBlocks };
+        m_freeBlocks = freeBlock;
+    }
+
+    size_t FixedSizePool::getUsedBlockCount() const
+    {
+        return m_usedBlocks;
+    }
+
+    size_t FixedSizePool::getChunkCount() const
+    {
+        return m_chunks.size();
+    }
+}
@@ -0,0 +1,48 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+namespace rlogic::internal
+{
+    // Allocates memory blocks of one fixed size from larger chunks, freed blocks are reused by following allocations.
+    // Meant for types which are allocated in big numbers (see PropertyImpl), saves per-allocation overhead of the heap,
+    // keeps objects allocated together close in memory and avoids fragmenting the heap with many small allocations.
+    // Chunks are kept for the lifetime of the pool, so that repeatedly creating and destroying objects doesn't go to the heap again.
+    // Not thread-safe, every logic engine has its own property pool (see ApiObjects).
+    class FixedSizePool
+    {
+    public:
+        FixedSizePool(size_t blockSize, size_t blocksPerChunk);
+
+        [[nodiscard]] void* allocate();
+        void deallocate(void* block);
+
+        [[nodiscard]] size_t getUsedBlockCount() const;
+        [[nodiscard]] size_t getChunkCount() const;
+
+    private:
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        const size_t m_blockSize;
+        const size_t m_blocksPerChunk;
+
+        std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+        // blocks of last chunk from this index on were never used
+        size_t m_nextUntouchedBlock = 0u;
+        FreeBlock* m_freeBlocks = nullptr;
+        size_t m_usedBlocks = 0u;
+    };
+}
@@ -18,31 +18,54 @@
 #include "internals/TypeUtils.h"
 
 #include <cassert>
+#include <algorithm>
 #include "fmt/format.h"
 
 namespace rlogic::internal
 {
+    namespace
+    {
+        // Describes each step of the path by the linked properties, or as binding dependency if nodes are not linked directly
+        std::string DescribeNodePath(const NodeVector& path)
+        {
+            std::vector<std::string> steps;
+            for (size_t i = 1u; i < path.size(); ++i)
+            {
+                LogicNodeImpl& sourceNode = *path[i - 1u];
+                const LogicNodeImpl& targetNode = *path[i];
+
+                const auto& outgoingLinks = sourceNode.getLinkPropagationTable();
+                const auto linkIt = std::find_if(outgoingLinks.cbegin(), outgoingLinks.cend(), [&targetNode](const LinkPropagationEntry& link) {
+                    return link.targetNode == &targetNode && !link.target->getIncomingLink().isWeakLink;
+                });
+
+                if (linkIt != outgoingLinks.cend())
+                    steps.push_back(fmt::format("'{}.{}' -> '{}.{}'", sourceNode.getName(), linkIt->source->getName(), targetNode.getName(), linkIt->target->getName()));
+                else
+                    steps.push_back(fmt::format("'{}' -> '{}' (binding dependency)", sourceNode.getName(), targetNode.getName()));
+            }
+
+            return fmt::format("{}", fmt::join(steps, ", "));
+        }
+    }
 
     void LogicNodeDependencies::addNode(LogicNodeImpl& node)
     {
         assert(!m_logicNodeDAG.containsNode(node));
         m_logicNodeDAG.addNode(node);
-        m_nodeTopologyChanged = true;
     }
 
     void LogicNodeDependencies::removeNode(LogicNodeImpl& node)
     {
         assert(m_logicNodeDAG.containsNode(node));
         m_logicNodeDAG.removeNode(node);
+        // DAG keeps the order of remaining nodes, cache is refreshed on next access
+        node.setDirtyWorklist(nullptr, 0u);
+    }
 
-        // Remove the node from the cache without reordering the rest (unless there is no cache yet)
-        // Removing nodes does not require topology update (we don't guarantee specific ordering when
-        // nodes are not related, we only guarantee relative ordering when nodes are linked)
-        if (m_cachedTopologicallySortedNodes)
-        {
-            NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
-            cachedNodes.erase(std::remove(cachedNodes.begin(), cachedNodes.end(), &node), cachedNodes.end());
-        }
+    bool LogicNodeDependencies::containsNode(const LogicNodeImpl& node) const
+    {
+        return m_logicNodeDAG.containsNode(node);
     }
 
     bool LogicNodeDependencies::isLinked(const LogicNodeImpl& logicNode) const
@@ -89,15 +112,48 @@ namespace rlogic::internal
 
     const std::optional<NodeVector>& LogicNodeDependencies::getTopologicallySortedNodes()
     {
-        if (m_nodeTopologyChanged)
+        if (m_logicNodeDAG.getTopologicalOrderRevision() != m_cachedOrderRevision)
         {
             m_cachedTopologicallySortedNodes = m_logicNodeDAG.getTopologicallySortedNodes();
-            m_nodeTopologyChanged = false;
+            // sorting can change the revision when the order was recomputed from scratch
+            m_cachedOrderRevision = m_logicNodeDAG.getTopologicalOrderRevision();
+            if (m_cachedTopologicallySortedNodes)
+                m_dirtyNodeWorklist.reset(*m_cachedTopologicallySortedNodes);
         }
 
         return m_cachedTopologicallySortedNodes;
     }
 
+    const std::vector<size_t>& LogicNodeDependencies::getTopologicalLevels()
+    {
+        assert(m_logicNodeDAG.getTopologicalOrderRevision() == m_cachedOrderRevision && m_cachedTopologicallySortedNodes);
+        // levels change also with edges which agree with the current order (and thus don't change the order revision)
+        if (!m_cachedTopologicalLevels || m_logicNodeDAG.getStructureRevision() != m_cachedLevelsStructureRevision)
+        {
+            m_cachedTopologicalLevels = m_logicNodeDAG.getTopologicalLevels(*m_cachedTopologicallySortedNodes);
+            m_cachedLevelsStructureRevision = m_logicNodeDAG.getStructureRevision();
+        }
+
+        return *m_cachedTopologicalLevels;
+    }
+
+    DirtyNodeWorklist& LogicNodeDependencies::getDirtyNodeWorklist()
+    {
+        assert(m_logicNodeDAG.getTopologicalOrderRevision() == m_cachedOrderRevision && m_cachedTopologicallySortedNodes);
+        return m_dirtyNodeWorklist;
+    }
+
+    std::vector<size_t> LogicNodeDependencies::getUpstreamNodeRanks(const NodeVector& nodes) const
+    {
+        assert(m_logicNodeDAG.getTopologicalOrderRevision() == m_cachedOrderRevision && m_cachedTopologicallySortedNodes);
+        return m_logicNodeDAG.getUpstreamNodeRanks(nodes);
+    }
+
+    uint64_t LogicNodeDependencies::getTopologicalOrderRevision() const
+    {
+        return m_logicNodeDAG.getTopologicalOrderRevision();
+    }
+
     bool LogicNodeDependencies::link(PropertyImpl& output, PropertyImpl& input, bool isWeakLink, ErrorReporting& errorReporting)
     {
         if (!m_logicNodeDAG.containsNode(output.getLogicNode()))
@@ -155,17 +211,34 @@ namespace rlogic::internal
             return false;
         }
 
-        input.setIncomingLink(output, isWeakLink);
-
         if (!isWeakLink)
         {
-            const bool isNewEdge = m_logicNodeDAG.addEdge(output.getLogicNode(), input.getLogicNode());
-            if (isNewEdge)
+            // new link closes a cycle if output's node is already reachable from input's node
+            const NodeVector cyclePath = m_logicNodeDAG.findPath(input.getLogicNode(), output.getLogicNode());
+            if (!cyclePath.empty())
             {
-                m_nodeTopologyChanged = true;
+                errorReporting.add(fmt::format("Failed to link property '{}' of LogicNode '{}' to property '{}' of LogicNode '{}', the link would create a cycle: {}, '{}.{}' -> '{}.{}'. Use a weak link to break the cycle",
+                    output.getName(),
+                    output.getLogicNode().getName(),
+                    input.getName(),
+                    input.getLogicNode().getName(),
+                    DescribeNodePath(cyclePath),
+                    output.getLogicNode().getName(),
+                    output.getName(),
+                    input.getLogicNode().getName(),
+                    input.getName()
+                ), nullptr, EErrorType::IllegalArgument);
+                return false;
             }
         }
 
+        input.setIncomingLink(output, isWeakLink);
+
+        if (!isWeakLink)
+        {
+            m_logicNodeDAG.addEdge(output.getLogicNode(), input.getLogicNode());
+        }
+
         // TODO Violin don't set anything dirty here, handle dirtiness purely in update()
         input.getLogicNode().setDirty(true);
         output.getLogicNode().setDirty(true);
@@ -212,8 +285,7 @@ namespace rlogic::internal
         assert(m_logicNodeDAG.containsNode(binding));
         assert(&node != &binding);
 
-        if (m_logicNodeDAG.addEdge(binding, node))
-            m_nodeTopologyChanged = true;
+        m_logicNodeDAG.addEdge(binding, node);
     }
 
     void LogicNodeDependencies::removeBindingDependency(RamsesBindingImpl& binding, LogicNodeImpl& node)
@@ -9,8 +9,7 @@
 #pragma once
 
 #include "internals/DirectedAcyclicGraph.h"
-
-#include <unordered_set>
+#include "internals/DirtyNodeWorklist.h"
 
 namespace rlogic::internal
 {
@@ -19,8 +18,6 @@ namespace rlogic::internal
     class PropertyImpl;
     class RamsesBindingImpl;
 
-    using NodeSet = std::unordered_set<LogicNodeImpl*>;
-
     // Tracks the links between logic nodes and orders them based on the topological structure derived
     // from those links.
     class LogicNodeDependencies
@@ -28,10 +25,22 @@ namespace rlogic::internal
     public:
         // The primary purpose of this class
         [[nodiscard]] const std::optional<NodeVector>& getTopologicallySortedNodes();
+        // Level of each sorted node (indexed by rank), nodes of same level are mutually independent, see DirectedAcyclicGraph::getTopologicalLevels
+        // Only valid to call after getTopologicallySortedNodes succeeded
+        [[nodiscard]] const std::vector<size_t>& getTopologicalLevels();
+        // Dirty nodes marked by their rank in sorted nodes
+        // Only valid to call after getTopologicallySortedNodes succeeded
+        [[nodiscard]] DirtyNodeWorklist& getDirtyNodeWorklist();
+        // Ranks of given nodes and all nodes they depend on, see DirectedAcyclicGraph::getUpstreamNodeRanks
+        // Only valid to call after getTopologicallySortedNodes succeeded
+        [[nodiscard]] std::vector<size_t> getUpstreamNodeRanks(const NodeVector& nodes) const;
+        // Ranks of nodes in sorted nodes stay the same as long as this value does not change
+        [[nodiscard]] uint64_t getTopologicalOrderRevision() const;
 
         // Nodes management
         void addNode(LogicNodeImpl& node);
         void removeNode(LogicNodeImpl& node);
+        [[nodiscard]] bool containsNode(const LogicNodeImpl& node) const;
 
         // Link management
         bool link(PropertyImpl& output, PropertyImpl& input, bool isWeakLink, ErrorReporting& errorReporting);
@@ -48,7 +57,12 @@ namespace rlogic::internal
         [[nodiscard]] bool isLinked(PropertyImpl& input) const;
 
         // Initial state: no nodes and no need to re-compute node topology
+        // Cache is up to date as long as the DAG's order revision matches the cached one
         std::optional<NodeVector> m_cachedTopologicallySortedNodes = NodeVector{};
-        bool m_nodeTopologyChanged = false;
+        uint64_t m_cachedOrderRevision = 0u;
+        // Levels are up to date as long as the DAG's structure revision matches the cached one
+        std::optional<std::vector<size_t>> m_cachedTopologicalLevels;
+        uint64_t m_cachedLevelsStructureRevision = 0u;
+        DirtyNodeWorklist m_dirtyNodeWorklist;
     };
 }
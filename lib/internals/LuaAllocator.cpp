@@ -0,0 +1,255 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaAllocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace rlogic::internal
+{
+    void LuaMemoryAccountReleaser::operator()(LuaMemoryAccount* account) const
+    {
+        account->allocator.releaseAccount(account);
+    }
+
+    LuaAllocator::LuaAllocator() = default;
+
+    // Lua state using this allocator is closed before, i.e. all blocks were freed, chunks are released here
+    LuaAllocator::~LuaAllocator() noexcept = default;
+
+    void* LuaAllocator::Allocate(void* userData, void* ptr, size_t oldSize, size_t newSize)
+    {
+        return static_cast<LuaAllocator*>(userData)->reallocate(ptr, oldSize, newSize);
+    }
+
+    LuaMemoryAccountPtr LuaAllocator::createAccount()
+    {
+        m_accounts.push_back(std::make_unique<LuaMemoryAccount>(LuaMemoryAccount{ *this }));
+        return LuaMemoryAccountPtr{ m_accounts.back().get() };
+    }
+
+    size_t LuaAllocator::getAllocatedBytes() const
+    {
+        return m_allocatedBytes;
+    }
+
+    void* LuaAllocator::reallocate(void* ptr, size_t oldSize, size_t newSize)
+    {
+        if (newSize == 0u)
+        {
+            if (ptr != nullptr)
+            {
+                const BlockHeader& header = GetHeader(ptr);
+                const size_t blockClass = GetBlockClass(header);
+                credit(GetAccount(header), oldSize);
+                freeBlock(static_cast<std::byte*>(ptr) - HeaderSize, blockClass);
+            }
+            return nullptr;
+        }
+
+        LuaMemoryAccount* account = m_currentAccount;
+        LuaMemoryAccount* previousAccount = (ptr != nullptr ? GetAccount(GetHeader(ptr)) : nullptr);
+
+        // Lua relies on shrinking never to fail, limit is only checked when growing
+        if (account != nullptr && account->limit != 0u && newSize > oldSize)
+        {
+            const size_t ownedBefore = (previousAccount == account ? oldSize : 0u);
+            if (account->usedBytes - ownedBefore + newSize > account->limit)
+            {
+                account->limitExceeded = true;
+                return nullptr;
+            }
+        }
+
+        void* block = nullptr;
+        const size_t newBlockSize = newSize + HeaderSize;
+        size_t blockClass = GetBlockClassForSize(newBlockSize);
+        if (ptr == nullptr)
+        {
+            block = allocateBlock(blockClass, newBlockSize);
+            if (block == nullptr)
+                return nullptr;
+        }
+        else
+        {
+            void* oldBlock = static_cast<std::byte*>(ptr) - HeaderSize;
+            const size_t oldBlockClass = GetBlockClass(GetHeader(ptr));
+            const bool shrinking = (newSize <= oldSize);
+            if (oldBlockClass != HeapBlockClass && GetPooledBlockSize(oldBlockClass) >= newBlockSize)
+            {
+                // fits into pooled block, a shrunk block stays in its size class
+                block = oldBlock;
+                blockClass = oldBlockClass;
+            }
+            else if (oldBlockClass == HeapBlockClass && blockClass == HeapBlockClass)
+            {
+                block = std::realloc(oldBlock, newBlockSize);
+                if (block == nullptr)
+                {
+                    if (!shrinking)
+                        return nullptr;
+                    block = oldBlock;
+                }
+            }
+            else
+            {
+                block = allocateBlock(blockClass, newBlockSize);
+                if (block != nullptr)
+                {
+                    std::memcpy(static_cast<std::byte*>(block) + HeaderSize, ptr, std::min(oldSize, newSize));
+                    freeBlock(oldBlock, oldBlockClass);
+                }
+                else
+                {
+                    // only heap block shrinking into a size class can get here, it stays on heap then
+                    if (!shrinking)
+                        return nullptr;
+                    block = oldBlock;
+                    blockClass = oldBlockClass;
+                }
+            }
+
+            credit(previousAccount, oldSize);
+        }
+
+        // block changing size belongs to whoever changed it last
+        charge(account, newSize);
+        new (block) BlockHeader{ reinterpret_cast<uintptr_t>(account) | blockClass };
+        return static_cast<std::byte*>(block) + HeaderSize;
+    }
+
+    void* LuaAllocator::allocateBlock(size_t blockClass, size_t size)
+    {
+        if (blockClass == HeapBlockClass)
+            return std::malloc(size);
+
+        SizeClassPool& pool = m_pools[blockClass];
+        if (pool.freeBlocks != nullptr)
+        {
+            FreeBlock* block = pool.freeBlocks;
+            pool.freeBlocks = block->next;
+            return block;
+        }
+
+        const size_t blockSize = GetPooledBlockSize(blockClass);
+        if (pool.untouched == pool.untouchedEnd)
+        {
+            // Lua reports out of memory as error, exception must not propagate through Lua
+            std::unique_ptr<std::byte[]> chunk{ new (std::nothrow) std::byte[ChunkSize] };
+            if (!chunk)
+                return nullptr;
+            try
+            {
+                m_chunks.push_back(std::move(chunk));
+            }
+            catch (const std::bad_alloc&)
+            {
+                return nullptr;
+            }
+            pool.untouched = m_chunks.back().get();
+            pool.untouchedEnd = pool.untouched + ChunkSize / blockSize * blockSize;
+        }
+
+        void* block = pool.untouched;
+        pool.untouched += blockSize;
+        return block;
+    }
+
+    void LuaAllocator::freeBlock(void* block, size_t blockClass)
+    {
+        if (blockClass == HeapBlockClass)
+        {
+            std::free(block);
+            return;
+        }
+
+        SizeClassPool& pool = m_pools[blockClass];
+        pool.freeBlocks = new (block) FreeBlock{ pool.freeBlocks };
+    }
+
+    void LuaAllocator::charge(LuaMemoryAccount* account, size_t size)
+    {
+        m_allocatedBytes += size;
+        if (account != nullptr)
+            account->usedBytes += size;
+    }
+
+    void LuaAllocator::credit(LuaMemoryAccount* account, size_t size)
+    {
+        assert(m_allocatedBytes >= size);
+        m_allocatedBytes -= size;
+        if (account != nullptr)
+        {
+            assert(account->usedBytes >= size);
+            account->usedBytes -= size;
+            if (account->released && account->usedBytes == 0u)
+                eraseAccount(account);
+        }
+    }
+
+    void LuaAllocator::releaseAccount(LuaMemoryAccount* account)
+    {
+        assert(account != m_currentAccount);
+        account->released = true;
+        if (account->usedBytes == 0u)
+            eraseAccount(account);
+    }
+
+    void LuaAllocator::eraseAccount(LuaMemoryAccount* account)
+    {
+        auto it = std::find_if(m_accounts.begin(), m_accounts.end(), [account](const auto& a) { return a.get() == account; });
+        assert(it != m_accounts.end());
+        std::swap(*it, m_accounts.back());
+        m_accounts.pop_back();
+    }
+
+    size_t LuaAllocator::GetBlockClassForSize(size_t blockSize)
+    {
+        assert(blockSize > 0u);
+        if (blockSize > MaxPooledBlockSize)
+            return HeapBlockClass;
+        return (blockSize - 1u) / SizeClassGranularity;
+    }
+
+    size_t LuaAllocator::GetPooledBlockSize(size_t blockClass)
+    {
+        assert(blockClass < SizeClassCount);
+        return (blockClass + 1u) * SizeClassGranularity;
+    }
+
+    LuaAllocator::BlockHeader& LuaAllocator::GetHeader(void* ptr)
+    {
+        return *static_cast<BlockHeader*>(static_cast<void*>(static_cast<std::byte*>(ptr) - HeaderSize));
+    }
+
+    LuaMemoryAccount* LuaAllocator::GetAccount(const BlockHeader& header)
+    {
+        return reinterpret_cast<LuaMemoryAccount*>(header.accountAndClass & ~uintptr_t(alignof(LuaMemoryAccount) - 1u));
+    }
+
+    size_t LuaAllocator::GetBlockClass(const BlockHeader& header)
+    {
+        return static_cast<size_t>(header.accountAndClass & uintptr_t(alignof(LuaMemoryAccount) - 1u));
+    }
+
+    LuaAllocator::ScopedAttribution::ScopedAttribution(LuaMemoryAccount& account)
+        : m_allocator{ account.allocator }
+        , m_previousAccount{ account.allocator.m_currentAccount }
+    {
+        m_allocator.m_currentAccount = &account;
+    }
+
+    LuaAllocator::ScopedAttribution::~ScopedAttribution() noexcept
+    {
+        m_allocator.m_currentAccount = m_previousAccount;
+    }
+}
@@ -0,0 +1,129 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    class LuaAllocator;
+
+    // Bytes of Lua memory owned by one script or module, see LuaAllocator
+    // Aligned so that block headers can keep the block class in low bits of the account pointer
+    struct alignas(32) LuaMemoryAccount
+    {
+        LuaAllocator& allocator;
+        size_t usedBytes = 0u;
+        // 0 means unlimited
+        size_t limit = 0u;
+        // set when an allocation failed because of the limit, reset by owner
+        bool limitExceeded = false;
+        // owner does not exist anymore, account is kept until all its memory is freed
+        bool released = false;
+    };
+
+    struct LuaMemoryAccountReleaser
+    {
+        void operator()(LuaMemoryAccount* account) const;
+    };
+    using LuaMemoryAccountPtr = std::unique_ptr<LuaMemoryAccount, LuaMemoryAccountReleaser>;
+
+    // Memory allocator of a Lua state (lua_Alloc). Small blocks (the vast majority of Lua allocations - strings, tables,
+    // closures, userdata) are served from free lists of fixed size classes to avoid heap traffic caused by garbage churn,
+    // bigger blocks go to the heap. Chunks backing the free lists are kept until the allocator is destroyed. Every block
+    // remembers its class and the account which was active when it was allocated, so that freeing it (usually by garbage
+    // collector, at any later time) is accounted to the right owner. Shrinking never fails, a block is kept if needed.
+    // Not thread-safe (no locking), a Lua state and thus its allocator is used by one thread at a time.
+    class LuaAllocator
+    {
+    public:
+        LuaAllocator();
+        ~LuaAllocator() noexcept;
+        LuaAllocator(const LuaAllocator& other) = delete;
+        LuaAllocator& operator=(const LuaAllocator& other) = delete;
+        LuaAllocator(LuaAllocator&& other) = delete;
+        LuaAllocator& operator=(LuaAllocator&& other) = delete;
+
+        // lua_Alloc compatible function, userData must point to LuaAllocator
+        [[nodiscard]] static void* Allocate(void* userData, void* ptr, size_t oldSize, size_t newSize);
+
+        [[nodiscard]] LuaMemoryAccountPtr createAccount();
+
+        // Allocations done while in scope are accounted to given account, and fail if they would exceed its limit
+        class ScopedAttribution
+        {
+        public:
+            explicit ScopedAttribution(LuaMemoryAccount& account);
+            ~ScopedAttribution() noexcept;
+            ScopedAttribution(const ScopedAttribution& other) = delete;
+            ScopedAttribution& operator=(const ScopedAttribution& other) = delete;
+
+        private:
+            LuaAllocator& m_allocator;
+            LuaMemoryAccount* m_previousAccount;
+        };
+
+        [[nodiscard]] size_t getAllocatedBytes() const;
+
+    private:
+        friend struct LuaMemoryAccountReleaser;
+
+        // account pointer with block class in its low bits
+        struct BlockHeader
+        {
+            uintptr_t accountAndClass;
+        };
+        // keeps memory returned to Lua aligned for any Lua type (LUAI_USER_ALIGNMENT_T)
+        static constexpr size_t HeaderSize = (alignof(double) > sizeof(BlockHeader) ? alignof(double) : sizeof(BlockHeader));
+        static constexpr size_t SizeClassGranularity = 16u;
+        static constexpr size_t MaxPooledBlockSize = 256u;
+        static constexpr size_t SizeClassCount = MaxPooledBlockSize / SizeClassGranularity;
+        // block classes are the size classes and this one for blocks allocated from heap
+        static constexpr size_t HeapBlockClass = SizeClassCount;
+        static_assert(HeapBlockClass < alignof(LuaMemoryAccount), "block class must fit into alignment bits of account pointer");
+        static constexpr size_t ChunkSize = 4096u;
+
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        // blocks of one size class, the never used rest of the last chunk of the class is handed out before anything else
+        struct SizeClassPool
+        {
+            FreeBlock* freeBlocks = nullptr;
+            std::byte* untouched = nullptr;
+            std::byte* untouchedEnd = nullptr;
+        };
+
+        [[nodiscard]] void* reallocate(void* ptr, size_t oldSize, size_t newSize);
+        [[nodiscard]] void* allocateBlock(size_t blockClass, size_t size);
+        void freeBlock(void* block, size_t blockClass);
+        void charge(LuaMemoryAccount* account, size_t size);
+        void credit(LuaMemoryAccount* account, size_t size);
+        void releaseAccount(LuaMemoryAccount* account);
+        void eraseAccount(LuaMemoryAccount* account);
+
+        [[nodiscard]] static size_t GetBlockClassForSize(size_t blockSize);
+        [[nodiscard]] static size_t GetPooledBlockSize(size_t blockClass);
+        [[nodiscard]] static BlockHeader& GetHeader(void* ptr);
+        [[nodiscard]] static LuaMemoryAccount* GetAccount(const BlockHeader& header);
+        [[nodiscard]] static size_t GetBlockClass(const BlockHeader& header);
+
+        std::array<SizeClassPool, SizeClassCount> m_pools;
+        std::vector<std::unique_ptr<std::byte[]>> m_chunks;
+        std::vector<std::unique_ptr<LuaMemoryAccount>> m_accounts;
+        LuaMemoryAccount* m_currentAccount = nullptr;
+        size_t m_allocatedBytes = 0u;
+    };
+}
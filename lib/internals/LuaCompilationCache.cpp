@@ -0,0 +1,99 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/LuaCompilationCache.h"
+
+#include <algorithm>
+#include <functional>
+
+namespace rlogic::internal
+{
+    LuaCompilationCache& LuaCompilationCache::Get()
+    {
+        static LuaCompilationCache cache;
+        return cache;
+    }
+
+    size_t LuaCompilationCache::Hash(std::string_view source)
+    {
+        return std::hash<std::string_view>{}(source);
+    }
+
+    bool LuaCompilationCache::Matches(const Entry& entry, const Key& key)
+    {
+        return entry.featureLevel == key.featureLevel
+            && entry.chunkName == key.chunkName
+            && entry.stdModules == key.stdModules
+            && entry.source == key.source;
+    }
+
+    std::shared_ptr<const LuaCompilationCache::Entry> LuaCompilationCache::findLocked(const Key& key, size_t hash)
+    {
+        auto range = m_entries.equal_range(hash);
+        for (auto it = range.first; it != range.second;)
+        {
+            std::shared_ptr<const Entry> entry = it->second.lock();
+            if (!entry)
+            {
+                it = m_entries.erase(it);
+                continue;
+            }
+            if (Matches(*entry, key))
+                return entry;
+            ++it;
+        }
+        return nullptr;
+    }
+
+    void LuaCompilationCache::removeExpiredEntries()
+    {
+        for (auto it = m_entries.begin(); it != m_entries.end();)
+            it = (it->second.expired() ? m_entries.erase(it) : std::next(it));
+    }
+
+    std::shared_ptr<const LuaCompilationCache::Entry> LuaCompilationCache::find(const Key& key)
+    {
+        const size_t hash = Hash(key.source);
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        return findLocked(key, hash);
+    }
+
+    std::shared_ptr<const LuaCompilationCache::Entry> LuaCompilationCache::add(Entry entry)
+    {
+        const size_t hash = Hash(entry.source);
+        // not make_shared, memory of entry must not be kept by weak references of the cache
+        std::shared_ptr<const Entry> newEntry{ new Entry{ std::move(entry) } };
+
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        std::shared_ptr<const Entry> existingEntry = findLocked(Key{ newEntry->source, newEntry->chunkName, newEntry->featureLevel, newEntry->stdModules }, hash);
+        if (existingEntry)
+            return existingEntry;
+
+        if (m_entries.size() >= m_cleanupThreshold)
+        {
+            removeExpiredEntries();
+            m_cleanupThreshold = std::max(MinCleanupThreshold, 2u * m_entries.size());
+        }
+        m_entries.emplace(hash, newEntry);
+        return newEntry;
+    }
+
+    void LuaCompilationCache::clear()
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        m_entries.clear();
+        m_cleanupThreshold = MinCleanupThreshold;
+    }
+
+    size_t LuaCompilationCache::getEntryCount()
+    {
+        std::lock_guard<std::mutex> lock{ m_mutex };
+        removeExpiredEntries();
+        return m_entries.size();
+    }
+}
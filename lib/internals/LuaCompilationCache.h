@@ -0,0 +1,84 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "impl/LuaConfigImpl.h"
+#include "internals/SolWrapper.h"
+#include "internals/TypeData.h"
+
+#include "ramses-logic/EFeatureLevel.h"
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace rlogic::internal
+{
+    // Process-wide cache of results of compiling Lua source code which do not depend on Lua state, shared by all logic engines
+    // which enabled it (see LogicEngine::enableSharedLuaCompilationCache). Engines loading same scripts/modules then compile each
+    // source only once: others load byte code instead of parsing source, and skip module declaration and interface extraction.
+    // Entries are owned by the scripts/modules compiled with them, the cache only refers to them weakly - an entry is gone once
+    // no Lua object uses it anymore, so the cache never holds more than the Lua code which is alive in some logic engine.
+    // Thread-safe, logic engines can be used from different threads.
+    class LuaCompilationCache
+    {
+    public:
+        // Refers to data of the caller, used only for lookup
+        struct Key
+        {
+            std::string_view source;
+            // chunk name is embedded in byte code
+            std::string_view chunkName;
+            EFeatureLevel featureLevel;
+            // interface extraction can depend on available standard modules
+            const StandardModules& stdModules;
+        };
+
+        struct Entry
+        {
+            // key data, the only stored copy of the source
+            std::string source;
+            std::string chunkName;
+            EFeatureLevel featureLevel;
+            StandardModules stdModules;
+
+            sol::bytecode byteCode;
+            std::vector<std::string> declaredModules;
+            // interface of script, only if it does not depend on user modules
+            std::optional<HierarchicalTypeData> inputsType;
+            std::optional<HierarchicalTypeData> outputsType;
+        };
+
+        [[nodiscard]] static LuaCompilationCache& Get();
+
+        [[nodiscard]] std::shared_ptr<const Entry> find(const Key& key);
+        // Returns the entry the caller has to keep alive, existing one if same key was added concurrently
+        [[nodiscard]] std::shared_ptr<const Entry> add(Entry entry);
+        void clear();
+        // Number of entries still used by some Lua object
+        [[nodiscard]] size_t getEntryCount();
+
+    private:
+        [[nodiscard]] static size_t Hash(std::string_view source);
+        [[nodiscard]] static bool Matches(const Entry& entry, const Key& key);
+        [[nodiscard]] std::shared_ptr<const Entry> findLocked(const Key& key, size_t hash);
+        void removeExpiredEntries();
+
+        std::mutex m_mutex;
+        // keyed by hash of source, entries with colliding hashes are told apart by their key data
+        std::unordered_multimap<size_t, std::weak_ptr<const Entry>> m_entries;
+        // expired entries of other sources are removed when map grows beyond this size, keeps cleanup amortized constant
+        size_t m_cleanupThreshold = MinCleanupThreshold;
+        static constexpr size_t MinCleanupThreshold = 64u;
+    };
+}
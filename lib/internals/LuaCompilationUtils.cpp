@@ -19,6 +19,7 @@
 #include "internals/PropertyTypeExtractor.h"
 #include "internals/EPropertySemantics.h"
 #include "internals/EnvironmentProtection.h"
+#include "internals/LuaCompilationCache.h"
 #include "fmt/format.h"
 #include "SolHelper.h"
 
@@ -37,6 +38,10 @@ namespace rlogic::internal
         EFeatureLevel featureLevel,
         bool enableDebugLogFunctions)
     {
+        // everything allocated by Lua for this script/module, also later at runtime, is accounted separately
+        LuaMemoryAccountPtr memoryAccount = solState.getAllocator().createAccount();
+        const LuaAllocator::ScopedAttribution memoryAttribution{ *memoryAccount };
+
         sol::environment env = solState.createEnvironment(stdModules, userModules, enableDebugLogFunctions);
         sol::table internalEnv = EnvironmentProtection::GetProtectedEnvironmentTable(env);
 
@@ -47,21 +52,52 @@ namespace rlogic::internal
         sol::protected_function mainFunction{};
         const std::string debuggingName = (featureLevel == EFeatureLevel_01 ? std::string(name) : "RL_lua_script");
 
+        // results of compiling same source are shared between logic engines, byte code from file does not need compiling
+        const bool useCache = solState.isSharedCompilationCacheEnabled() && byteCodeFromPrecompiledScript.empty();
+        std::shared_ptr<const LuaCompilationCache::Entry> cachedCompilation;
+        if (useCache)
+        {
+            cachedCompilation = LuaCompilationCache::Get().find(LuaCompilationCache::Key{ source, debuggingName, featureLevel, stdModules });
+            if (cachedCompilation)
+            {
+                if (!CheckDeclaredAndProvidedModules(cachedCompilation->declaredModules, userModules, name, errorReporting))
+                    return std::nullopt;
+
+                byteCodeFromPrecompiledScript = cachedCompilation->byteCode;
+                if (!inputsFromPrecompiledScript && cachedCompilation->inputsType && userModules.empty())
+                {
+                    assert(cachedCompilation->outputsType);
+                    inputsFromPrecompiledScript = std::make_unique<Property>(std::make_unique<PropertyImpl>(*cachedCompilation->inputsType, EPropertySemantics::ScriptInput));
+                    outputsFromPrecompiledScript = std::make_unique<Property>(std::make_unique<PropertyImpl>(*cachedCompilation->outputsType, EPropertySemantics::ScriptOutput));
+                }
+            }
+        }
+        std::vector<std::string> declaredModules;
+
         if (!byteCodeFromPrecompiledScript.empty())
         {
-            ScopedEnvironmentProtection p(env, EEnvProtectionFlag::LoadScript);
-            main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledScript.as_string_view(), debuggingName, env);
-            if (!main_result.valid())
+            std::optional<std::string> byteCodeError = CheckByteCodeBackend(byteCodeFromPrecompiledScript.as_string_view());
+            if (!byteCodeError)
+            {
+                ScopedEnvironmentProtection p(env, EEnvProtectionFlag::LoadScript);
+                main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledScript.as_string_view(), debuggingName, env);
+                if (!main_result.valid())
+                {
+                    sol::error error = main_result;
+                    byteCodeError = error.what();
+                }
+            }
+
+            if (byteCodeError)
             {
-                sol::error error = main_result;
                 if (source.empty())
                 {
-                    errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}': failed loading pre-compiled byte code and no source available to recompile:\n{}!", name, error.what()),
+                    errorReporting.add(fmt::format("Fatal error during loading of LuaScript '{}': failed loading pre-compiled byte code and no source available to recompile:\n{}!", name, *byteCodeError),
                         nullptr, EErrorType::BinaryVersionMismatch);
                     return std::nullopt;
                 }
 
-                LOG_WARN("Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, error.what());
+                LOG_WARN("Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, *byteCodeError);
                 byteCodeFromPrecompiledScript.clear();
             }
         }
@@ -76,8 +112,10 @@ namespace rlogic::internal
                 return std::nullopt;
             }
 
-            if (!CrossCheckDeclaredAndProvidedModules(source, userModules, name, errorReporting))
+            std::optional<std::vector<std::string>> extractedModules = ExtractModuleDependencies(source, errorReporting);
+            if (!extractedModules || !CheckDeclaredAndProvidedModules(*extractedModules, userModules, name, errorReporting))
                 return std::nullopt;
+            declaredModules = std::move(*extractedModules);
 
             mainFunction = load_result;
             env.set_on(mainFunction);
@@ -132,6 +170,8 @@ namespace rlogic::internal
 
         std::unique_ptr<Property> resultInputs;
         std::unique_ptr<Property> resultOutputs;
+        std::optional<HierarchicalTypeData> extractedInputsType;
+        std::optional<HierarchicalTypeData> extractedOutputsType;
 
         if (inputsFromPrecompiledScript)
         {
@@ -176,20 +216,35 @@ namespace rlogic::internal
                 return std::nullopt;
             }
 
-            HierarchicalTypeData extractedInputsType = inputsExtractor.getExtractedTypeData();
-            HierarchicalTypeData extractedOutputsType = outputsExtractor.getExtractedTypeData();
+            extractedInputsType = inputsExtractor.getExtractedTypeData();
+            extractedOutputsType = outputsExtractor.getExtractedTypeData();
             // Remove names
-            extractedInputsType.typeData.name = "";
-            extractedOutputsType.typeData.name = "";
+            extractedInputsType->typeData.name = "";
+            extractedOutputsType->typeData.name = "";
 
-            resultInputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(extractedInputsType, EPropertySemantics::ScriptInput));
-            resultOutputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(extractedOutputsType, EPropertySemantics::ScriptOutput));
+            resultInputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(*extractedInputsType, EPropertySemantics::ScriptInput));
+            resultOutputs = std::make_unique<Property>(std::make_unique<PropertyImpl>(*extractedOutputsType, EPropertySemantics::ScriptOutput));
         }
 
         sol::bytecode resultByteCode;
         if(featureLevel >= EFeatureLevel_02)
             resultByteCode = (byteCodeFromPrecompiledScript.empty() ? mainFunction.dump() : std::move(byteCodeFromPrecompiledScript));
 
+        // cache is filled only when compiled from source, i.e. main function is available
+        if (useCache && !cachedCompilation && mainFunction.valid())
+        {
+            const bool interfaceIndependentOfModules = userModules.empty() && extractedInputsType.has_value();
+            cachedCompilation = LuaCompilationCache::Get().add(LuaCompilationCache::Entry{
+                source,
+                debuggingName,
+                featureLevel,
+                stdModules,
+                resultByteCode.empty() ? mainFunction.dump() : resultByteCode,
+                std::move(declaredModules),
+                interfaceIndependentOfModules ? std::move(extractedInputsType) : std::nullopt,
+                interfaceIndependentOfModules ? std::move(extractedOutputsType) : std::nullopt });
+        }
+
         EnvironmentProtection::SetEnvironmentProtectionLevel(env, EEnvProtectionFlag::RunFunction);
 
         return LuaCompiledScript{
@@ -199,7 +254,9 @@ namespace rlogic::internal
                 solState,
                 stdModules,
                 userModules,
-                enableDebugLogFunctions
+                enableDebugLogFunctions,
+                std::move(memoryAccount),
+                std::move(cachedCompilation)
             },
             std::move(run),
             std::move(resultInputs),
@@ -306,6 +363,10 @@ namespace rlogic::internal
         EFeatureLevel featureLevel,
         bool enableDebugLogFunctions)
     {
+        // everything allocated by Lua for this script/module, also later at runtime, is accounted separately
+        LuaMemoryAccountPtr memoryAccount = solState.getAllocator().createAccount();
+        const LuaAllocator::ScopedAttribution memoryAttribution{ *memoryAccount };
+
         sol::environment env = solState.createEnvironment(stdModules, userModules, enableDebugLogFunctions);
         sol::table internalEnv = EnvironmentProtection::GetProtectedEnvironmentTable(env);
         // interface definitions can be provided within module, in order to be able to extract them
@@ -317,22 +378,45 @@ namespace rlogic::internal
         sol::protected_function_result main_result{};
 
         const std::string debuggingName = (featureLevel == EFeatureLevel_01 ? std::string(name) : "RL_lua_module");
+
+        const bool useCache = solState.isSharedCompilationCacheEnabled() && byteCodeFromPrecompiledModule.empty();
+        std::shared_ptr<const LuaCompilationCache::Entry> cachedCompilation;
+        if (useCache)
+        {
+            cachedCompilation = LuaCompilationCache::Get().find(LuaCompilationCache::Key{ source, debuggingName, featureLevel, stdModules });
+            if (cachedCompilation)
+            {
+                if (!CheckDeclaredAndProvidedModules(cachedCompilation->declaredModules, userModules, name, errorReporting))
+                    return std::nullopt;
+                byteCodeFromPrecompiledModule = cachedCompilation->byteCode;
+            }
+        }
+        std::vector<std::string> declaredModules;
+
         if (!byteCodeFromPrecompiledModule.empty())
         {
-            ScopedEnvironmentProtection p(env, EEnvProtectionFlag::Module);
-            main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledModule.as_string_view(), debuggingName, env);
+            std::optional<std::string> byteCodeError = CheckByteCodeBackend(byteCodeFromPrecompiledModule.as_string_view());
+            if (!byteCodeError)
+            {
+                ScopedEnvironmentProtection p(env, EEnvProtectionFlag::Module);
+                main_result = solState.loadScriptByteCode(byteCodeFromPrecompiledModule.as_string_view(), debuggingName, env);
+                if (!main_result.valid())
+                {
+                    sol::error error = main_result;
+                    byteCodeError = error.what();
+                }
+            }
 
-            if (!main_result.valid())
+            if (byteCodeError)
             {
-                sol::error error = main_result;
                 if (source.empty())
                 {
-                    errorReporting.add(fmt::format("Fatal error during loading of LuaModule '{}': failed loading pre-compiled byte code and no source available to recompile:\n{}!", name, error.what()),
+                    errorReporting.add(fmt::format("Fatal error during loading of LuaModule '{}': failed loading pre-compiled byte code and no source available to recompile:\n{}!", name, *byteCodeError),
                         nullptr, EErrorType::BinaryVersionMismatch);
                     return std::nullopt;
                 }
 
-                LOG_WARN("Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, error.what());
+                LOG_WARN("Performance warning! Error during loading of LuaScript '{}' from pre-compiled byte code, will try to recompile script from source code. Error:\n{}!", name, *byteCodeError);
                 byteCodeFromPrecompiledModule.clear();
             }
         }
@@ -347,8 +431,10 @@ namespace rlogic::internal
                 return std::nullopt;
             }
 
-            if (!CrossCheckDeclaredAndProvidedModules(source, userModules, name, errorReporting))
+            std::optional<std::vector<std::string>> extractedModules = ExtractModuleDependencies(source, errorReporting);
+            if (!extractedModules || !CheckDeclaredAndProvidedModules(*extractedModules, userModules, name, errorReporting))
                 return std::nullopt;
+            declaredModules = std::move(*extractedModules);
 
             mainFunction = load_result;
             env.set_on(mainFunction);
@@ -383,6 +469,19 @@ namespace rlogic::internal
         if(featureLevel >= EFeatureLevel_02)
             resultByteCode = (byteCodeFromPrecompiledModule.empty() ? mainFunction.dump() : std::move(byteCodeFromPrecompiledModule));
 
+        if (useCache && !cachedCompilation && mainFunction.valid())
+        {
+            cachedCompilation = LuaCompilationCache::Get().add(LuaCompilationCache::Entry{
+                source,
+                debuggingName,
+                featureLevel,
+                stdModules,
+                resultByteCode.empty() ? mainFunction.dump() : resultByteCode,
+                std::move(declaredModules),
+                std::nullopt,
+                std::nullopt });
+        }
+
         auto compiledModule = LuaCompiledModule{
             LuaCompiledSource{
                 std::move(source),
@@ -390,7 +489,9 @@ namespace rlogic::internal
                 solState,
                 stdModules,
                 userModules,
-                enableDebugLogFunctions
+                enableDebugLogFunctions,
+                std::move(memoryAccount),
+                std::move(cachedCompilation)
             },
             LuaCompilationUtils::MakeTableReadOnly(solState, moduleTable)
         };
@@ -454,24 +555,39 @@ namespace rlogic::internal
         return true;
     }
 
+    std::optional<std::string> LuaCompilationUtils::CheckByteCodeBackend(std::string_view byteCode)
+    {
+        const std::string_view byteCodeBackend = SolState::GetByteCodeBackendName(byteCode);
+        if (byteCodeBackend != SolState::GetLuaBackendName())
+            return fmt::format("byte code was produced by Lua backend '{}' but this build uses '{}'", byteCodeBackend, SolState::GetLuaBackendName());
+
+        return std::nullopt;
+    }
+
     bool LuaCompilationUtils::CrossCheckDeclaredAndProvidedModules(std::string_view source, const ModuleMapping& modules, std::string_view name, ErrorReporting& errorReporting)
     {
         std::optional<std::vector<std::string>> declaredModules = LuaCompilationUtils::ExtractModuleDependencies(source, errorReporting);
         if (!declaredModules) // failed extraction
             return false;
-        if (modules.empty() && declaredModules->empty()) // early out if no modules
+
+        return CheckDeclaredAndProvidedModules(std::move(*declaredModules), modules, name, errorReporting);
+    }
+
+    bool LuaCompilationUtils::CheckDeclaredAndProvidedModules(std::vector<std::string> declaredModules, const ModuleMapping& modules, std::string_view name, ErrorReporting& errorReporting)
+    {
+        if (modules.empty() && declaredModules.empty()) // early out if no modules
             return true;
 
         std::vector<std::string> providedModules;
         providedModules.reserve(modules.size());
         for (const auto& m : modules)
             providedModules.push_back(m.first);
-        std::sort(declaredModules->begin(), declaredModules->end());
+        std::sort(declaredModules.begin(), declaredModules.end());
         std::sort(providedModules.begin(), providedModules.end());
         if (providedModules != declaredModules)
         {
             std::string errMsg = fmt::format("[{}] Error while loading script/module. Module dependencies declared in source code do not match those provided by LuaConfig.\n", name);
-            errMsg += fmt::format("  Module dependencies declared in source code: {}\n", fmt::join(*declaredModules, ", "));
+            errMsg += fmt::format("  Module dependencies declared in source code: {}\n", fmt::join(declaredModules, ", "));
             errMsg += fmt::format("  Module dependencies provided on create API: {}", fmt::join(providedModules, ", "));
             errorReporting.add(errMsg, nullptr, EErrorType::IllegalArgument);
             return false;
@@ -10,6 +10,8 @@
 
 #include "impl/LuaConfigImpl.h"
 #include "internals/SolWrapper.h"
+#include "internals/LuaAllocator.h"
+#include "internals/LuaCompilationCache.h"
 
 #include "ramses-logic/EFeatureLevel.h"
 
@@ -37,6 +39,10 @@ namespace rlogic::internal
         StandardModules stdModules;
         ModuleMapping userModules;
         bool hasDebugLogFunctions = false;
+        // Lua memory owned by the script/module
+        LuaMemoryAccountPtr memoryAccount;
+        // Entry of shared compilation cache which must be kept alive as long as the compiled code is used (null if cache not used)
+        std::shared_ptr<const LuaCompilationCache::Entry> cacheEntry;
     };
 
     struct LuaCompiledScript
@@ -107,10 +113,19 @@ namespace rlogic::internal
         [[nodiscard]] static sol::table MakeTableReadOnly(SolState& solState, sol::table table);
 
     private:
+        // Returns error if byte code was not produced by the Lua backend this library is built against
+        [[nodiscard]] static std::optional<std::string> CheckByteCodeBackend(std::string_view byteCode);
+
         [[nodiscard]] static bool CrossCheckDeclaredAndProvidedModules(
             std::string_view source,
             const ModuleMapping& modules,
             std::string_view chunkname,
             ErrorReporting& errorReporting);
+
+        [[nodiscard]] static bool CheckDeclaredAndProvidedModules(
+            std::vector<std::string> declaredModules,
+            const ModuleMapping& modules,
+            std::string_view name,
+            ErrorReporting& errorReporting);
     };
 }
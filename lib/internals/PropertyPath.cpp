@@ -0,0 +1,134 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/PropertyPath.h"
+
+#include "ramses-logic/LogicNode.h"
+#include "ramses-logic/Property.h"
+#include "impl/PropertyImpl.h"
+#include "internals/ApiObjects.h"
+#include "internals/ErrorReporting.h"
+
+#include "fmt/format.h"
+
+#include <charconv>
+
+namespace rlogic::internal
+{
+    namespace
+    {
+        // Removes given segment from beginning of path if it is followed by end of path or by start of next segment
+        bool ConsumeSegment(std::string_view& path, std::string_view segment)
+        {
+            if (path.substr(0u, segment.size()) != segment)
+                return false;
+            if (path.size() > segment.size() && path[segment.size()] != '.' && path[segment.size()] != '[')
+                return false;
+
+            path.remove_prefix(segment.size());
+            return true;
+        }
+    }
+
+    Property* PropertyPath::Resolve(const ApiObjects& apiObjects, std::string_view path, ErrorReporting& errorReporting)
+    {
+        // node names can contain dots, try every dot followed by 'inputs' or 'outputs' as end of node name
+        for (size_t dotPos = path.find('.'); dotPos != std::string_view::npos; dotPos = path.find('.', dotPos + 1u))
+        {
+            std::string_view childrenPath = path.substr(dotPos + 1u);
+            const bool isInputsPath = ConsumeSegment(childrenPath, "inputs");
+            if (!isInputsPath && !ConsumeSegment(childrenPath, "outputs"))
+                continue;
+
+            const std::string_view nodeName = path.substr(0u, dotPos);
+            for (LogicObject* object : apiObjects.getApiObjectContainer<LogicObject>())
+            {
+                LogicNode* node = object->as<LogicNode>();
+                if (node == nullptr || node->getName() != nodeName)
+                    continue;
+
+                Property* root = (isInputsPath ? node->getInputs() : node->getOutputs());
+                if (root == nullptr)
+                {
+                    errorReporting.add(fmt::format("Cannot resolve property path '{}', logic node '{}' has no {}", path, nodeName, isInputsPath ? "inputs" : "outputs"),
+                        node, EErrorType::IllegalArgument);
+                    return nullptr;
+                }
+
+                return ResolveChildren(*root, childrenPath, path, errorReporting);
+            }
+        }
+
+        errorReporting.add(fmt::format("Cannot resolve property path '{}', expected name of existing logic node followed by '.inputs' or '.outputs'", path),
+            nullptr, EErrorType::IllegalArgument);
+        return nullptr;
+    }
+
+    Property* PropertyPath::ResolveChildren(Property& root, std::string_view childrenPath, std::string_view path, ErrorReporting& errorReporting)
+    {
+        Property* property = &root;
+        std::string_view remainingPath = childrenPath;
+        while (!remainingPath.empty())
+        {
+            Property* child = nullptr;
+            if (remainingPath.front() == '.')
+            {
+                remainingPath.remove_prefix(1u);
+                const std::string_view childName = remainingPath.substr(0u, remainingPath.find_first_of(".["));
+                remainingPath.remove_prefix(childName.size());
+
+                // look up field without getChild, which logs an error when field is missing - path error is reported below instead
+                if (!childName.empty() && property->getType() == EPropertyType::Struct)
+                {
+                    const std::optional<size_t> fieldIndex = property->m_impl->findChildIndex(childName);
+                    if (fieldIndex)
+                        child = property->getChild(*fieldIndex);
+                }
+
+                if (child == nullptr)
+                {
+                    errorReporting.add(fmt::format("Cannot resolve property path '{}', property '{}' has no field '{}'", path, property->getName(), childName),
+                        nullptr, EErrorType::IllegalArgument);
+                    return nullptr;
+                }
+            }
+            else if (remainingPath.front() == '[')
+            {
+                const size_t closingPos = remainingPath.find(']');
+                const std::string_view indexString = remainingPath.substr(1u, closingPos == std::string_view::npos ? std::string_view::npos : closingPos - 1u);
+                size_t index = 0u;
+                const auto parseResult = std::from_chars(indexString.data(), indexString.data() + indexString.size(), index);
+                if (closingPos == std::string_view::npos || indexString.empty() || parseResult.ec != std::errc() || parseResult.ptr != indexString.data() + indexString.size())
+                {
+                    errorReporting.add(fmt::format("Cannot resolve property path '{}', invalid array index '{}'", path, remainingPath), nullptr, EErrorType::IllegalArgument);
+                    return nullptr;
+                }
+                remainingPath.remove_prefix(closingPos + 1u);
+
+                if (property->getType() == EPropertyType::Array && index < property->getChildCount())
+                    child = property->getChild(index);
+
+                if (child == nullptr)
+                {
+                    errorReporting.add(fmt::format("Cannot resolve property path '{}', property '{}' has no array element with index {}", path, property->getName(), index),
+                        nullptr, EErrorType::IllegalArgument);
+                    return nullptr;
+                }
+            }
+            else
+            {
+                errorReporting.add(fmt::format("Cannot resolve property path '{}', expected '.' or '[' at '{}'", path, remainingPath), nullptr, EErrorType::IllegalArgument);
+                return nullptr;
+            }
+
+            property = child;
+        }
+
+        return property;
+    }
+}
@@ -0,0 +1,35 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <string_view>
+
+namespace rlogic
+{
+    class Property;
+}
+
+namespace rlogic::internal
+{
+    class ApiObjects;
+    class ErrorReporting;
+
+    class PropertyPath
+    {
+    public:
+        // Resolves path of form 'NodeName.inputs.struct.field[index]' (or 'outputs' respectively) to property,
+        // node name can contain dots, array elements are addressed by 0-based index.
+        // Returns nullptr and reports error if path is malformed or does not lead to existing property.
+        [[nodiscard]] static Property* Resolve(const ApiObjects& apiObjects, std::string_view path, ErrorReporting& errorReporting);
+
+    private:
+        // Resolves part of path following 'inputs' or 'outputs' (e.g. '.struct.field[index]'), empty path resolves to the root itself
+        [[nodiscard]] static Property* ResolveChildren(Property& root, std::string_view childrenPath, std::string_view path, ErrorReporting& errorReporting);
+    };
+}
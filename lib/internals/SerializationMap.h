@@ -56,6 +56,22 @@ namespace rlogic::internal
             return 0;
         }
 
+        void storeSourceCodeOffset(const std::string& sourceCode, flatbuffers::Offset<flatbuffers::String> offset)
+        {
+            Store(&sourceCode, offset, m_sourceCodeOffsets);
+        }
+
+        // Source code is identified by address, i.e. only source shared by script instances is found (see LuaScriptCode)
+        [[nodiscard]] flatbuffers::Offset<flatbuffers::String> resolveSourceCodeOffsetIfFound(const std::string& sourceCode) const
+        {
+            const auto it = m_sourceCodeOffsets.find(&sourceCode);
+            if (it != m_sourceCodeOffsets.cend())
+            {
+                return it->second;
+            }
+            return 0;
+        }
+
     private:
         template <typename Key, typename Value>
         static void Store(Key key, Value value, std::unordered_map<Key, Value>& container)
@@ -76,5 +92,6 @@ namespace rlogic::internal
         std::unordered_map<const PropertyImpl*, flatbuffers::Offset<rlogic_serialization::Property>> m_properties;
         std::unordered_map<uint64_t, flatbuffers::Offset<rlogic_serialization::DataArray>> m_dataArrays;
         std::unordered_map<std::string, flatbuffers::Offset<flatbuffers::Vector<uint8_t>>> m_byteCodeOffsets;
+        std::unordered_map<const std::string*, flatbuffers::Offset<flatbuffers::String>> m_sourceCodeOffsets;
     };
 }
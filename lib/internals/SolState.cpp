@@ -21,6 +21,9 @@
 
 namespace rlogic::internal
 {
+    static constexpr std::string_view Lua51BackendName = "Lua 5.1";
+    static constexpr std::string_view LuaJITBackendName = "LuaJIT";
+
     // NOLINTNEXTLINE(performance-unnecessary-value-param) The signature is forced by SOL. Therefore we have to disable this warning.
     static int solExceptionHandler(lua_State* L, sol::optional<const std::exception&> maybe_exception, sol::string_view description)
     {
@@ -32,6 +35,9 @@ namespace rlogic::internal
     }
 
     SolState::SolState()
+#if !SOL_IS_ON(SOL_USE_LUAJIT_I_)
+        : m_solState(&sol::default_at_panic, &LuaAllocator::Allocate, &m_allocator)
+#endif
     {
         m_safeBaselibSymbols = {
             "assert",
@@ -63,6 +69,12 @@ namespace rlogic::internal
             m_solState.open_libraries(solLib);
         }
 
+#if SOL_IS_ON(SOL_USE_LUAJIT_I_)
+        // LuaJIT enables its JIT compiler only when the jit library is opened. The library table itself is not
+        // exposed to scripts, because environments only receive the standard modules they request
+        m_solState.open_libraries(sol::lib::jit);
+#endif
+
         m_solState.set_exception_handler(&solExceptionHandler);
 
         // TODO Violin only register wrappers to runtime environments, not in the global environment
@@ -92,7 +104,7 @@ namespace rlogic::internal
         for (const auto& module : userModules)
         {
             assert(!SolState::IsReservedModuleName(module.first));
-            protectedEnv[module.first] = module.second->m_impl.getModule();
+            protectedEnv[module.first] = module.second->m_impl.getModule(*this);
         }
 
         // TODO Violin take a closer look at this, should not be needed
@@ -180,6 +192,25 @@ namespace rlogic::internal
         return false;
     }
 
+    std::string_view SolState::GetLuaBackendName()
+    {
+#if SOL_IS_ON(SOL_USE_LUAJIT_I_)
+        return LuaJITBackendName;
+#else
+        return Lua51BackendName;
+#endif
+    }
+
+    std::string_view SolState::GetByteCodeBackendName(std::string_view byteCode)
+    {
+        // Lua 5.1 chunks start with ESC 'Lua' and version byte 0x51, LuaJIT chunks with ESC 'LJ'
+        if (byteCode.substr(0u, 5u) == std::string_view("\x1bLua\x51", 5u))
+            return Lua51BackendName;
+        if (byteCode.substr(0u, 3u) == std::string_view("\x1bLJ", 3u))
+            return LuaJITBackendName;
+        return "unknown";
+    }
+
     sol::table SolState::createTable()
     {
         return m_solState.create_table();
@@ -189,4 +220,56 @@ namespace rlogic::internal
     {
         return lua_gettop(m_solState.lua_state());
     }
+
+    void SolState::setAutomaticGarbageCollection(bool enabled)
+    {
+        m_automaticGarbageCollection = enabled;
+        lua_gc(m_solState.lua_state(), enabled ? LUA_GCRESTART : LUA_GCSTOP, 0);
+    }
+
+    void SolState::setGarbageCollectorParameters(int pausePercent, int stepMultiplierPercent)
+    {
+        lua_gc(m_solState.lua_state(), LUA_GCSETPAUSE, pausePercent);
+        lua_gc(m_solState.lua_state(), LUA_GCSETSTEPMUL, stepMultiplierPercent);
+    }
+
+    bool SolState::stepGarbageCollection()
+    {
+        // step size 0 executes single basic step
+        const bool cycleFinished = (lua_gc(m_solState.lua_state(), LUA_GCSTEP, 0) != 0);
+        // explicit step re-arms automatic collection, stop it again if disabled
+        if (!m_automaticGarbageCollection)
+            lua_gc(m_solState.lua_state(), LUA_GCSTOP, 0);
+        return cycleFinished;
+    }
+
+    size_t SolState::getMemoryUsage() const
+    {
+        lua_State* L = m_solState.lua_state();
+        return static_cast<size_t>(lua_gc(L, LUA_GCCOUNT, 0)) * 1024u + static_cast<size_t>(lua_gc(L, LUA_GCCOUNTB, 0));
+    }
+
+    LuaAllocator& SolState::getAllocator()
+    {
+        return m_allocator;
+    }
+
+    bool SolState::HasMemoryAccounting()
+    {
+#if SOL_IS_ON(SOL_USE_LUAJIT_I_)
+        return false;
+#else
+        return true;
+#endif
+    }
+
+    void SolState::enableSharedCompilationCache(bool enabled)
+    {
+        m_sharedCompilationCacheEnabled = enabled;
+    }
+
+    bool SolState::isSharedCompilationCacheEnabled() const
+    {
+        return m_sharedCompilationCacheEnabled;
+    }
 }
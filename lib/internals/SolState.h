@@ -10,6 +10,7 @@
 
 #include "impl/LuaConfigImpl.h"
 #include "internals/SolWrapper.h"
+#include "internals/LuaAllocator.h"
 
 #include <string_view>
 #include <utility>
@@ -57,12 +58,37 @@ namespace rlogic::internal
 
         [[nodiscard]] int getNumElementsInLuaStack() const;
 
+        // Garbage collection, Lua 5.1 and LuaJIT provide only incremental collector
+        void setAutomaticGarbageCollection(bool enabled);
+        void setGarbageCollectorParameters(int pausePercent, int stepMultiplierPercent);
+        // Executes one incremental step, returns true if the step finished a collection cycle
+        bool stepGarbageCollection();
+        [[nodiscard]] size_t getMemoryUsage() const;
+
+        // Allocator used for all memory of this Lua state, tracks memory per script/module (see LuaAllocator::ScopedAttribution)
+        [[nodiscard]] LuaAllocator& getAllocator();
+        // LuaJIT on 64 bit platforms does not accept custom allocator, memory is then not tracked per script/module and limits are not enforced
+        [[nodiscard]] static bool HasMemoryAccounting();
+
+        // Scripts/modules compiled for this state use process-wide LuaCompilationCache
+        void enableSharedCompilationCache(bool enabled);
+        [[nodiscard]] bool isSharedCompilationCacheEnabled() const;
+
         [[nodiscard]] static bool IsReservedModuleName(std::string_view name);
 
+        // Lua backend this library is built against (see ramses-logic_USE_LUAJIT). Bytecode can only be loaded by the backend
+        // which produced it, the backend is identified by the signature every Lua/LuaJIT bytecode chunk starts with
+        [[nodiscard]] static std::string_view GetLuaBackendName();
+        [[nodiscard]] static std::string_view GetByteCodeBackendName(std::string_view byteCode);
+
     private:
+        // declared before Lua state, must be destroyed after it
+        LuaAllocator m_allocator;
         sol::state m_solState;
         // Cached to avoid unnecessary heap allocations
         std::vector<std::string> m_safeBaselibSymbols;
+        bool m_automaticGarbageCollection = true;
+        bool m_sharedCompilationCacheEnabled = false;
 
         void mapStandardModules(const StandardModules& stdModules, sol::environment& env);
         [[nodiscard]] static std::optional<std::string_view> GetStdModuleName(rlogic::EStandardModule m);
@@ -85,7 +85,12 @@ __pragma(warning(pop))
 #endif
 
 #if SOL_IS_ON(SOL_USE_CXX_LUAJIT_I_)
-#error "LuaJIT is not tested yet, thus we expect that SOL_USE_CXX_LUAJIT is off currently"
+#error "LuaJIT is supported only as C library (see ramses-logic_USE_LUAJIT), thus we expect that SOL_USE_CXX_LUAJIT is off"
+#endif
+
+// Configured with SOL_LUAJIT=1 when building with ramses-logic_USE_LUAJIT
+#if SOL_IS_ON(SOL_USE_LUAJIT_I_) && SOL_IS_ON(SOL_USE_CXX_LUA_I_)
+#error "LuaJIT is a C library, sol must include its headers with C linkage"
 #endif
 
 #if SOL_IS_ON(SOL_USE_LUA_HPP_I_)
@@ -0,0 +1,84 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    // Passes latest version of a value from one writer thread to one reader thread without locks, both sides are wait-free.
+    // Writer and reader each own one of three buffers exclusively, the third one holds the latest published value.
+    // Publishing swaps the writer's buffer with the middle one, acquiring swaps the reader's buffer with the middle one
+    // if it holds a value which was not acquired yet. Reader thus never sees a partially written value and writer never waits
+    // for reader. Values which were published but never acquired are skipped.
+    template <typename T>
+    class TripleBuffer
+    {
+    public:
+        // Writer side: buffer to fill with next value, it keeps the contents written before its last swap (not the latest published value)
+        [[nodiscard]] T& getWriteBuffer()
+        {
+            return m_buffers[m_writeIndex];
+        }
+
+        // Writer side: latest published value, can be read by writer concurrently to reader because only writer modifies buffers
+        [[nodiscard]] const T& getLastPublishedBuffer() const
+        {
+            return m_buffers[m_publishedIndex];
+        }
+
+        // Writer side: makes contents of write buffer available to reader
+        void publish()
+        {
+            m_publishedIndex = m_writeIndex;
+            const uint8_t previousMiddle = m_middle.exchange(static_cast<uint8_t>(m_writeIndex | NewValueFlag), std::memory_order_acq_rel);
+            m_writeIndex = previousMiddle & IndexMask;
+        }
+
+        // Reader side: makes latest published value available in read buffer, returns false if there is no newer value than the one already there
+        bool acquireLatest()
+        {
+            if ((m_middle.load(std::memory_order_relaxed) & NewValueFlag) == 0u)
+                return false;
+
+            const uint8_t previousMiddle = m_middle.exchange(m_readIndex, std::memory_order_acq_rel);
+            m_readIndex = previousMiddle & IndexMask;
+            return true;
+        }
+
+        // Reader side: latest acquired value
+        [[nodiscard]] const T& getReadBuffer() const
+        {
+            return m_buffers[m_readIndex];
+        }
+
+        // Not thread-safe, must not be called while writer or reader is active
+        void reset(const T& value)
+        {
+            m_buffers.fill(value);
+            m_writeIndex = 0u;
+            m_publishedIndex = 1u;
+            m_middle.store(1u, std::memory_order_relaxed);
+            m_readIndex = 2u;
+        }
+
+    private:
+        static constexpr uint8_t IndexMask = 0x3u;
+        static constexpr uint8_t NewValueFlag = 0x4u;
+
+        std::array<T, 3> m_buffers;
+        uint8_t m_writeIndex = 0u;
+        uint8_t m_publishedIndex = 1u;
+        // index of middle buffer, combined with flag whether it holds newly published value
+        std::atomic<uint8_t> m_middle{ 1u };
+        uint8_t m_readIndex = 2u;
+    };
+}
@@ -114,7 +114,7 @@ namespace rlogic::internal
             const size_t arraySize = arrayProperty.getChildCount();
             for (size_t i = 0; i < arraySize; ++i)
             {
-                FlattenElementIntoArray(arrayData, *arrayProperty.getChild(i)->get<LOGICTYPE>());
+                FlattenElementIntoArray(arrayData, arrayProperty.getChild(i)->m_impl->getValueAs<LOGICTYPE>());
             }
 
             return arrayData;
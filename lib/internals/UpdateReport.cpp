@@ -41,11 +41,28 @@ namespace rlogic::internal
         m_nodeExecutionStarted.reset();
     }
 
+    void UpdateReport::nodeExecuted(LogicNodeImpl& node, ReportTimeUnits executionTime)
+    {
+        assert(!m_nodeExecutionStarted);
+        m_nodesExecuted.push_back({ &node, executionTime });
+    }
+
     void UpdateReport::nodeSkippedExecution(LogicNodeImpl& node)
     {
         m_nodesSkippedExecution.push_back(&node);
     }
 
+    void UpdateReport::nodesDeferred(size_t deferredNodes)
+    {
+        m_deferredNodes = deferredNodes;
+    }
+
+    void UpdateReport::luaMemoryMeasured(size_t memoryUsage, ReportTimeUnits garbageCollectionTime)
+    {
+        m_luaMemoryUsage = memoryUsage;
+        m_luaGarbageCollectionTime = garbageCollectionTime;
+    }
+
     void UpdateReport::clear()
     {
         m_nodesExecuted.clear();
@@ -53,6 +70,9 @@ namespace rlogic::internal
         for (auto& s : m_sectionExecutionTime)
             s = ReportTimeUnits{ 0u };
         m_activatedLinks = 0u;
+        m_deferredNodes = 0u;
+        m_luaMemoryUsage = 0u;
+        m_luaGarbageCollectionTime = ReportTimeUnits{ 0u };
 
         // clear also internals in case update/measure was interrupted due to error
         m_nodeExecutionStarted.reset();
@@ -80,4 +100,19 @@ namespace rlogic::internal
         return m_activatedLinks;
     }
 
+    size_t UpdateReport::getDeferredNodeCount() const
+    {
+        return m_deferredNodes;
+    }
+
+    size_t UpdateReport::getLuaMemoryUsage() const
+    {
+        return m_luaMemoryUsage;
+    }
+
+    UpdateReport::ReportTimeUnits UpdateReport::getLuaGarbageCollectionTime() const
+    {
+        return m_luaGarbageCollectionTime;
+    }
+
 }
@@ -34,14 +34,22 @@ namespace rlogic::internal
         void sectionFinished(ETimingSection section);
         void nodeExecutionStarted(LogicNodeImpl& node);
         void nodeExecutionFinished();
+        // for nodes whose execution was measured outside (e.g. on worker thread)
+        void nodeExecuted(LogicNodeImpl& node, ReportTimeUnits executionTime);
         void nodeSkippedExecution(LogicNodeImpl& node);
         void linksActivated(size_t activatedLinks);
+        // dirty nodes left for next update because update budget was exhausted
+        void nodesDeferred(size_t deferredNodes);
+        void luaMemoryMeasured(size_t memoryUsage, ReportTimeUnits garbageCollectionTime);
         void clear();
 
         [[nodiscard]] const LogicNodesTimed& getNodesExecuted() const;
         [[nodiscard]] const LogicNodes& getNodesSkippedExecution() const;
         [[nodiscard]] ReportTimeUnits getSectionExecutionTime(ETimingSection section) const;
         [[nodiscard]] size_t getLinkActivations() const;
+        [[nodiscard]] size_t getDeferredNodeCount() const;
+        [[nodiscard]] size_t getLuaMemoryUsage() const;
+        [[nodiscard]] ReportTimeUnits getLuaGarbageCollectionTime() const;
 
     private:
         using Clock = std::chrono::steady_clock;
@@ -51,6 +59,9 @@ namespace rlogic::internal
         LogicNodes m_nodesSkippedExecution;
         std::array<ReportTimeUnits, 2u> m_sectionExecutionTime = { ReportTimeUnits{ 0 } };
         size_t m_activatedLinks {0u};
+        size_t m_deferredNodes {0u};
+        size_t m_luaMemoryUsage {0u};
+        ReportTimeUnits m_luaGarbageCollectionTime {0};
 
         std::optional<TimePoint> m_nodeExecutionStarted;
         std::array<std::optional<TimePoint>, 2u> m_sectionStarted;
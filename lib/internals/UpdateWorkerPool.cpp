@@ -0,0 +1,98 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/UpdateWorkerPool.h"
+
+#include <cassert>
+
+namespace rlogic::internal
+{
+    UpdateWorkerPool::UpdateWorkerPool(size_t workerCount)
+    {
+        m_workers.reserve(workerCount);
+        for (size_t i = 0u; i < workerCount; ++i)
+            m_workers.emplace_back([this]() { workerLoop(); });
+    }
+
+    UpdateWorkerPool::~UpdateWorkerPool() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_batchStarted.notify_all();
+
+        for (auto& worker : m_workers)
+            worker.join();
+    }
+
+    size_t UpdateWorkerPool::getWorkerCount() const
+    {
+        return m_workers.size();
+    }
+
+    void UpdateWorkerPool::execute(size_t taskCount, const Task& task)
+    {
+        // not worth waking up the workers
+        if (m_workers.empty() || taskCount <= 1u)
+        {
+            for (size_t i = 0u; i < taskCount; ++i)
+                task(i);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            assert(m_busyWorkers == 0u);
+            m_task = &task;
+            m_taskCount = taskCount;
+            m_nextTask = 0u;
+            m_busyWorkers = m_workers.size();
+            ++m_batchId;
+        }
+        m_batchStarted.notify_all();
+
+        executePendingTasks();
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_batchFinished.wait(lock, [this]() { return m_busyWorkers == 0u; });
+        m_task = nullptr;
+    }
+
+    void UpdateWorkerPool::workerLoop()
+    {
+        uint64_t lastBatchId = 0u;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_batchStarted.wait(lock, [this, lastBatchId]() { return m_shutdown || m_batchId != lastBatchId; });
+                if (m_shutdown)
+                    return;
+                lastBatchId = m_batchId;
+            }
+
+            executePendingTasks();
+
+            bool lastWorkerDone = false;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                assert(m_busyWorkers > 0u);
+                lastWorkerDone = (--m_busyWorkers == 0u);
+            }
+            if (lastWorkerDone)
+                m_batchFinished.notify_one();
+        }
+    }
+
+    void UpdateWorkerPool::executePendingTasks()
+    {
+        for (size_t taskIdx = m_nextTask.fetch_add(1u); taskIdx < m_taskCount; taskIdx = m_nextTask.fetch_add(1u))
+            (*m_task)(taskIdx);
+    }
+}
@@ -0,0 +1,59 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <cstdint>
+
+namespace rlogic::internal
+{
+    // Fixed set of worker threads used to execute independent logic nodes of one topological level concurrently.
+    // The calling thread always takes part in the execution, i.e. a pool with N workers runs tasks on N+1 threads.
+    class UpdateWorkerPool
+    {
+    public:
+        using Task = std::function<void(size_t)>;
+
+        explicit UpdateWorkerPool(size_t workerCount);
+        ~UpdateWorkerPool() noexcept;
+
+        UpdateWorkerPool(const UpdateWorkerPool& other) = delete;
+        UpdateWorkerPool& operator=(const UpdateWorkerPool& other) = delete;
+        UpdateWorkerPool(UpdateWorkerPool&& other) = delete;
+        UpdateWorkerPool& operator=(UpdateWorkerPool&& other) = delete;
+
+        [[nodiscard]] size_t getWorkerCount() const;
+
+        // Executes task(i) for each i in [0, taskCount) and blocks until all of them finished.
+        // Tasks are picked in arbitrary order by arbitrary threads, they must not depend on each other.
+        void execute(size_t taskCount, const Task& task);
+
+    private:
+        void workerLoop();
+        void executePendingTasks();
+
+        std::vector<std::thread> m_workers;
+
+        std::mutex m_mutex;
+        std::condition_variable m_batchStarted;
+        std::condition_variable m_batchFinished;
+
+        const Task* m_task = nullptr;
+        size_t m_taskCount = 0u;
+        std::atomic<size_t> m_nextTask {0u};
+        size_t m_busyWorkers = 0u;
+        uint64_t m_batchId = 0u;
+        bool m_shutdown = false;
+    };
+}
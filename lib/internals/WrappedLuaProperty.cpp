@@ -223,15 +223,27 @@ namespace rlogic::internal
                 sol_helper::throwSolException("Bad access to property '{}'! {}", m_wrappedProperty.get().getName(), structFieldName.getError());
             }
 
-            for (size_t i = 0; i < m_wrappedChildProperties.size(); ++i)
+            // Lua strings are interned, i.e. the same field name used in a script is always the same Lua string, so its address
+            // identifies the field. The address can be reused by another string once the key was garbage collected, hence the name check on hit.
+            const std::string_view key = structFieldName.getData();
+            const auto cachedIt = m_childIndexByLuaKey.find(key.data());
+            if (cachedIt != m_childIndexByLuaKey.end() && m_wrappedChildProperties[cachedIt->second].m_wrappedProperty.get().getName() == key)
+            {
+                return cachedIt->second;
+            }
+
+            // wrapped children are in same order as children of wrapped property
+            const std::optional<size_t> childIndex = m_wrappedProperty.get().findChildIndex(key);
+            if (childIndex)
             {
-                if (m_wrappedChildProperties[i].m_wrappedProperty.get().getName() == structFieldName.getData())
-                {
-                    return i;
-                }
+                // stale addresses of collected keys can pile up when keys are created at runtime, bound the cache by number of fields
+                if (m_childIndexByLuaKey.size() >= 2u * m_wrappedChildProperties.size())
+                    m_childIndexByLuaKey.clear();
+                m_childIndexByLuaKey[key.data()] = *childIndex;
+                return *childIndex;
             }
 
-            throw BadStructAccess(std::string(structFieldName.getData()), fmt::format("Tried to access undefined struct property '{}'", structFieldName.getData()));
+            throw BadStructAccess(std::string(key), fmt::format("Tried to access undefined struct property '{}'", key));
         }
 
         if (propertyType == EPropertyType::Array)
@@ -13,6 +13,8 @@
 #include "impl/PropertyImpl.h"
 #include "internals/SolState.h"
 
+#include <unordered_map>
+
 namespace rlogic
 {
     class Property;
@@ -52,6 +54,8 @@ namespace rlogic::internal
     private:
         std::reference_wrapper<PropertyImpl> m_wrappedProperty;
         std::vector<WrappedLuaProperty> m_wrappedChildProperties;
+        // Struct field indices resolved from Lua string keys, keyed by address of the (interned) Lua string
+        mutable std::unordered_map<const char*, size_t> m_childIndexByLuaKey;
 
         template <typename T, int N>
         [[nodiscard]] sol::object extractVectorComponent(sol::this_state solState, const sol::object& index) const;
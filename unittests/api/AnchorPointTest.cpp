@@ -395,6 +395,140 @@ namespace rlogic::internal
         expectNodeSkipped(*script);
     }
 
+    class AnAnchorPoint_TransformTracking : public AnAnchorPoint_Dirtiness
+    {
+    protected:
+        void SetUp() override
+        {
+            AnAnchorPoint_Dirtiness::SetUp();
+            m_logicEngine.enableTransformChangeTracking(true);
+        }
+    };
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsNotExecutedIfNothingChanged)
+    {
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeExecuted(anchorPoint);
+
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeSkipped(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsExecutedWhenNodeBindingChangesTransformation)
+    {
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeSkipped(anchorPoint);
+
+        EXPECT_TRUE(m_nodeBinding.getInputs()->getChild("translation")->set<vec3f>({ 123.f, 231.f, 321.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeExecuted(anchorPoint);
+
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeSkipped(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsNotExecutedWhenNodeBindingChangesVisibility)
+    {
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_nodeBinding.getInputs()->getChild("visibility")->set(false));
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeSkipped(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsExecutedWhenBindingOfParentNodeChangesTransformation)
+    {
+        auto parentNode = m_scene->createNode();
+        parentNode->addChild(*m_node);
+        auto& parentBinding = *m_logicEngine.createRamsesNodeBinding(*parentNode);
+
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(parentBinding.getInputs()->getChild("scaling")->set<vec3f>({ 2.f, 2.f, 2.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeExecuted(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsExecutedWhenBindingOfCameraParentNodeChangesTransformation)
+    {
+        auto parentNode = m_scene->createNode();
+        parentNode->addChild(m_perspCamera);
+        auto& parentBinding = *m_logicEngine.createRamsesNodeBinding(*parentNode);
+
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(parentBinding.getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeExecuted(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsExecutedWhenCameraBindingChangesViewport)
+    {
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_perspCameraBinding.getInputs()->getChild("viewport")->getChild("width")->set(100));
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeExecuted(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsNotExecutedWhenUnrelatedNodeBindingChangesTransformation)
+    {
+        auto& unrelatedBinding = *m_logicEngine.createRamsesNodeBinding(*m_scene->createNode());
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(unrelatedBinding.getInputs()->getChild("translation")->set<vec3f>({ 1.f, 2.f, 3.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeSkipped(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsExecutedAfterRamsesTransformsInvalidated)
+    {
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+
+        // modifications of ramses scene outside of logic engine are not tracked
+        m_node->setTranslation(123.f, 231.f, 321.f);
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeSkipped(anchorPoint);
+
+        m_logicEngine.invalidateRamsesTransforms();
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeExecuted(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, IsExecutedInEveryUpdateAfterTrackingDisabled)
+    {
+        const auto& anchorPoint = *m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeSkipped(anchorPoint);
+
+        m_logicEngine.enableTransformChangeTracking(false);
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeExecuted(anchorPoint);
+        EXPECT_TRUE(m_logicEngine.update());
+        expectNodeExecuted(anchorPoint);
+    }
+
+    TEST_F(AnAnchorPoint_TransformTracking, StopsTrackingDestroyedAnchorPoint)
+    {
+        auto* anchorPoint = m_logicEngine.createAnchorPoint(m_nodeBinding, m_perspCameraBinding, "anchor");
+        EXPECT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.destroy(*anchorPoint));
+
+        EXPECT_TRUE(m_nodeBinding.getInputs()->getChild("translation")->set<vec3f>({ 123.f, 231.f, 321.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_nodeBinding.m_nodeBinding.getRamsesStateDependents().empty());
+    }
+
     // This test is to cover update order of anchor point with unknown dependencies.
     // Anchor point is special in sense it depends on ramses node (via binding), however those depend on other ramses nodes
     // (transformation topology), e.g. node ancestor, which can be affected by another node binding via script for example.
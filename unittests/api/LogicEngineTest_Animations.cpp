@@ -299,4 +299,49 @@ namespace rlogic::internal
         setTickerAndUpdate(1000000);
         expectNodeValues(1.f, 0.f);
     }
+
+    TEST_F(ALogicEngine_Animations, ManyIndependentAnimationsProduceSameResultsWithParallelUpdate)
+    {
+        const auto dataArray = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f }, "dataarray2");
+        AnimationNodeConfig config;
+        config.addChannel({ "channel", dataArray, dataArray, rlogic::EInterpolationType::Linear });
+
+        const auto controlScript = m_logicEngine.createLuaScript(R"(
+            function interface(IN,OUT)
+                IN.ticker = Type:Int64()
+                OUT.progress = Type:Float()
+            end
+            function run(IN,OUT)
+                OUT.progress = IN.ticker / 1000000
+            end
+        )");
+        m_logicEngine.link(*m_timer->getOutputs()->getChild("ticker_us"), *controlScript->getInputs()->getChild("ticker"));
+
+        std::vector<AnimationNode*> animations;
+        std::vector<LuaScript*> consumers;
+        for (size_t i = 0u; i < 32u; ++i)
+        {
+            animations.push_back(m_logicEngine.createAnimationNode(config));
+            consumers.push_back(m_logicEngine.createLuaScript(ScriptScalarToVecSrc));
+            ASSERT_TRUE(m_logicEngine.link(*controlScript->getOutputs()->getChild("progress"), *animations.back()->getInputs()->getChild("progress")));
+            ASSERT_TRUE(m_logicEngine.link(*animations.back()->getOutputs()->getChild("channel"), *consumers.back()->getInputs()->getChild("scalar")));
+        }
+
+        m_logicEngine.setParallelUpdateWorkerCount(3u);
+        for (int64_t tick : { 1, 250000, 500000, 1000000 })
+        {
+            setTickerAndUpdate(tick);
+            ASSERT_TRUE(m_logicEngine.getErrors().empty());
+
+            const float expectedValue = static_cast<float>(tick) / 1000000.f;
+            for (const auto consumer : consumers)
+                EXPECT_NEAR(expectedValue, (*consumer->getOutputs()->getChild("vec")->get<vec3f>())[0], 1e-5f);
+        }
+
+        // switch back to serial update
+        m_logicEngine.setParallelUpdateWorkerCount(0u);
+        setTickerAndUpdate(750000);
+        for (const auto consumer : consumers)
+            EXPECT_NEAR(0.75f, (*consumer->getOutputs()->getChild("vec")->get<vec3f>())[0], 1e-5f);
+    }
 }
@@ -466,6 +466,14 @@ namespace rlogic::internal
 
         static void checkContents(LogicEngine& logicEngine, ramses::Scene& scene)
         {
+            // files were exported before update rate divisor was introduced
+            for (const LogicObject* obj : logicEngine.getCollection<LogicObject>())
+            {
+                const auto logicNode = obj->as<LogicNode>();
+                if (logicNode)
+                    EXPECT_EQ(1u, logicNode->getUpdateRateDivisor());
+            }
+
             // check for content expected to exist
             // higher feature level always contains content supported by lower level
             switch (logicEngine.getFeatureLevel())
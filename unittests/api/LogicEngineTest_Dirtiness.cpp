@@ -134,6 +134,55 @@ namespace rlogic::internal
         EXPECT_TRUE(camBinding->m_impl.isDirty());
     }
 
+    TEST_P(ALogicEngine_Dirtiness, SettingManyPropertyValuesAtOnceMarksOnlyNodesWithChangedValuesDirty)
+    {
+        LuaScript* script1 = m_logicEngine.createLuaScript(m_minimal_script);
+        LuaScript* script2 = m_logicEngine.createLuaScript(m_minimal_script);
+        RamsesNodeBinding* nodeBinding = m_logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "");
+        m_logicEngine.update();
+
+        EXPECT_TRUE(m_logicEngine.setPropertyValues<int32_t>({ { script1->getInputs()->getChild("data"), 5 }, { script2->getInputs()->getChild("data"), 0 } }));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ(5, *script1->getInputs()->getChild("data")->get<int32_t>());
+        EXPECT_TRUE(script1->m_impl.isDirty());
+        EXPECT_FALSE(script2->m_impl.isDirty());
+
+        // binding inputs always mark binding dirty, same as with Property::set
+        EXPECT_TRUE(m_logicEngine.setPropertyValues<vec3f>({ { nodeBinding->getInputs()->getChild("scaling"), vec3f{ 1.f, 1.f, 1.f } } }));
+        EXPECT_TRUE(nodeBinding->m_impl.isDirty());
+    }
+
+    TEST_P(ALogicEngine_Dirtiness, SettingManyPropertyValuesAtOnceAppliesNoneIfOneOfThemCannotBeSet)
+    {
+        LuaScript* script = m_logicEngine.createLuaScript(m_minimal_script, {}, "script");
+        m_logicEngine.update();
+
+        EXPECT_FALSE(m_logicEngine.setPropertyValues<int32_t>({ { script->getInputs()->getChild("data"), 5 }, { script->getOutputs()->getChild("data"), 5 } }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot set property 'data' which is an output.", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(script, m_logicEngine.getErrors()[0].object);
+        EXPECT_EQ(0, *script->getInputs()->getChild("data")->get<int32_t>());
+        EXPECT_FALSE(script->m_impl.isDirty());
+
+        EXPECT_FALSE(m_logicEngine.setPropertyValues<float>({ { script->getInputs()->getChild("data"), 5.f } }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Invalid type when setting property 'data', correct type is 'Int32'", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_P(ALogicEngine_Dirtiness, SettingManyPropertyValuesAtOnceFailsForPropertiesNotOwnedByThisLogicEngine)
+    {
+        LogicEngine otherEngine{ GetParam() };
+        LuaScript* otherScript = otherEngine.createLuaScript(m_minimal_script, {}, "otherScript");
+
+        EXPECT_FALSE(m_logicEngine.setPropertyValues<int32_t>({ { otherScript->getInputs()->getChild("data"), 5 } }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot set value of property 'data', LogicNode 'otherScript' is not an instance of this LogicEngine", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.setPropertyValues<int32_t>({ { nullptr, 5 } }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot set value of a null property", m_logicEngine.getErrors()[0].message);
+    }
+
     TEST_P(ALogicEngine_Dirtiness, DirtyAfterCreatingRenderPassBinding_AndChangingInput)
     {
         if (GetParam() < EFeatureLevel_02)
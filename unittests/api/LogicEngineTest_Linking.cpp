@@ -281,9 +281,9 @@ namespace rlogic
         EXPECT_TRUE(m_logicEngine.link(*vec3Source, *vec3Target));
     }
 
-    TEST_P(ALogicEngine_Linking, ProducesErrorOnNextUpdateIfLinkCycleWasCreated)
+    TEST_P(ALogicEngine_Linking, ProducesErrorIfLinkWouldCreateCycle)
     {
-        LuaScript& loopScript = *m_logicEngine.createLuaScript(m_minimalLinkScript);
+        LuaScript& loopScript = *m_logicEngine.createLuaScript(m_minimalLinkScript, {}, "LoopScript");
         const Property* sourceInput = m_sourceScript.getInputs()->getChild("target");
         const Property* sourceOutput = m_sourceScript.getOutputs()->getChild("source");
         const Property* targetInput = m_targetScript.getInputs()->getChild("target");
@@ -293,17 +293,36 @@ namespace rlogic
 
         EXPECT_TRUE(m_logicEngine.link(*sourceOutput, *targetInput));
         EXPECT_TRUE(m_logicEngine.link(*targetOutput, *loopInput));
-        EXPECT_TRUE(m_logicEngine.link(*loopOutput, *sourceInput));
-        EXPECT_FALSE(m_logicEngine.update());
+        EXPECT_FALSE(m_logicEngine.link(*loopOutput, *sourceInput));
         auto errors = m_logicEngine.getErrors();
         ASSERT_EQ(1u, errors.size());
-        EXPECT_EQ("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling update()!", errors[0].message);
+        EXPECT_EQ("Failed to link property 'source' of LogicNode 'LoopScript' to property 'target' of LogicNode 'SourceScript', the link would create a cycle: "
+            "'SourceScript.source' -> 'TargetScript.target', 'TargetScript.source' -> 'LoopScript.target', 'LoopScript.source' -> 'SourceScript.target'. Use a weak link to break the cycle",
+            errors[0].message);
+        EXPECT_FALSE(sourceInput->isLinked());
 
-        // Also refuse to save to file
-        EXPECT_FALSE(m_logicEngine.saveToFile("will_not_write"));
-        errors = m_logicEngine.getErrors();
+        // Graph stays valid
+        EXPECT_TRUE(m_logicEngine.update());
+
+        // Weak link is allowed to close the cycle
+        EXPECT_TRUE(m_logicEngine.linkWeak(*loopOutput, *sourceInput));
+        EXPECT_TRUE(m_logicEngine.update());
+    }
+
+    TEST_P(ALogicEngine_Linking, ProducesErrorIfLinkWouldCreateCycleBetweenTwoNodes)
+    {
+        EXPECT_TRUE(m_logicEngine.link(m_sourceProperty, m_targetProperty));
+        EXPECT_FALSE(m_logicEngine.link(*m_targetScript.getOutputs()->getChild("source"), *m_sourceScript.getInputs()->getChild("target")));
+        auto errors = m_logicEngine.getErrors();
         ASSERT_EQ(1u, errors.size());
-        EXPECT_EQ("Failed to sort logic nodes based on links between their properties. Create a loop-free link graph before calling saveToFile()!", errors[0].message);
+        EXPECT_EQ("Failed to link property 'source' of LogicNode 'TargetScript' to property 'target' of LogicNode 'SourceScript', the link would create a cycle: "
+            "'SourceScript.source' -> 'TargetScript.target', 'TargetScript.source' -> 'SourceScript.target'. Use a weak link to break the cycle",
+            errors[0].message);
+
+        // After unlinking, reversed link can be created
+        EXPECT_TRUE(m_logicEngine.unlink(m_sourceProperty, m_targetProperty));
+        EXPECT_TRUE(m_logicEngine.link(*m_targetScript.getOutputs()->getChild("source"), *m_sourceScript.getInputs()->getChild("target")));
+        EXPECT_TRUE(m_logicEngine.update());
     }
 
     TEST_P(ALogicEngine_Linking, PropagatesValuesAcrossMultipleLinksInAChain)
@@ -2481,4 +2500,45 @@ namespace rlogic
         EXPECT_TRUE(m_logicEngine.destroy(*targetBinding));
         EXPECT_TRUE(m_logicEngine.update());
     }
+
+    TEST_F(ALogicEngine_Linking_Confidence, PropagatesValuesOverLinksChangedBetweenUpdates)
+    {
+        const std::string_view passThroughScript = R"(
+            function interface(IN,OUT)
+                IN.struct = { nested = { int = Type:Int32() } }
+                OUT.struct = { nested = { int = Type:Int32() } }
+            end
+
+            function run(IN,OUT)
+                OUT.struct = IN.struct
+            end
+        )";
+
+        LuaScript& sourceScript(*m_logicEngine.createLuaScript(passThroughScript));
+        LuaScript* targetScript1 = m_logicEngine.createLuaScript(passThroughScript);
+        LuaScript& targetScript2(*m_logicEngine.createLuaScript(passThroughScript));
+
+        Property& sourceInput(*sourceScript.getInputs()->getChild("struct")->getChild("nested")->getChild("int"));
+        const Property& sourceOutput(*sourceScript.getOutputs()->getChild("struct")->getChild("nested")->getChild("int"));
+        const Property& target2Output(*targetScript2.getOutputs()->getChild("struct")->getChild("nested")->getChild("int"));
+
+        EXPECT_TRUE(m_logicEngine.link(sourceOutput, *targetScript1->getInputs()->getChild("struct")->getChild("nested")->getChild("int")));
+        EXPECT_TRUE(sourceInput.set(1));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1, *targetScript1->getOutputs()->getChild("struct")->getChild("nested")->getChild("int")->get<int32_t>());
+
+        // destroy link target while link is active and link to another script, source is dirty and propagates again
+        EXPECT_TRUE(m_logicEngine.destroy(*targetScript1));
+        EXPECT_TRUE(sourceInput.set(2));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.link(sourceOutput, *targetScript2.getInputs()->getChild("struct")->getChild("nested")->getChild("int")));
+        EXPECT_TRUE(sourceInput.set(3));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, *target2Output.get<int32_t>());
+
+        EXPECT_TRUE(m_logicEngine.unlink(sourceOutput, *targetScript2.getInputs()->getChild("struct")->getChild("nested")->getChild("int")));
+        EXPECT_TRUE(sourceInput.set(4));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3, *target2Output.get<int32_t>());
+    }
 }
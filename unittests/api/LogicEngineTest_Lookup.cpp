@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "LogicEngineTest_Base.h"
+#include "LogTestUtils.h"
 #include "ramses-logic/AnimationNodeConfig.h"
 
 #include "impl/LuaModuleImpl.h"
@@ -546,5 +547,74 @@ namespace rlogic
         EXPECT_EQ(anchor, &anchorImpl.getLogicObject());
         EXPECT_EQ(skin, &skinImpl.getLogicObject());
     }
-}
 
+    class ALogicEngine_PropertyPathLookup : public ALogicEngine_Lookup
+    {
+    protected:
+        ALogicEngine_PropertyPathLookup()
+        {
+            m_script = m_logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.a = { b = Type:Array(4, Type:Int32()) }
+                    IN.structs = Type:Array(2, { x = Type:Float() })
+                    OUT.out = Type:Int32()
+                end
+                function run(IN,OUT)
+                end
+            )", {}, "my.script");
+        }
+
+        void expectError(std::string_view path, std::string_view expectedError)
+        {
+            // only the path error is logged, no additional errors from looking up missing children
+            std::vector<std::string> loggedErrors;
+            ScopedLogContextLevel logCollector{ ELogMessageType::Error, [&loggedErrors](ELogMessageType /*type*/, std::string_view message)
+            {
+                loggedErrors.emplace_back(message);
+            }
+            };
+
+            EXPECT_EQ(nullptr, m_logicEngine.resolvePropertyPath(path));
+            ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+            EXPECT_EQ(expectedError, m_logicEngine.getErrors()[0].message);
+            ASSERT_EQ(1u, loggedErrors.size());
+            EXPECT_EQ(expectedError, loggedErrors[0]);
+        }
+
+        LuaScript* m_script = nullptr;
+    };
+
+    TEST_F(ALogicEngine_PropertyPathLookup, ResolvesNestedPropertiesOfNodeWithDotsInName)
+    {
+        EXPECT_EQ(m_script->getInputs(), m_logicEngine.resolvePropertyPath("my.script.inputs"));
+        EXPECT_EQ(m_script->getOutputs()->getChild("out"), m_logicEngine.resolvePropertyPath("my.script.outputs.out"));
+        EXPECT_EQ(m_script->getInputs()->getChild("a")->getChild("b")->getChild(3u), m_logicEngine.resolvePropertyPath("my.script.inputs.a.b[3]"));
+        EXPECT_EQ(m_script->getInputs()->getChild("structs")->getChild(1u)->getChild("x"), m_logicEngine.resolvePropertyPath("my.script.inputs.structs[1].x"));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+    }
+
+    TEST_F(ALogicEngine_PropertyPathLookup, ResolvedPropertyCanBeUsedToSetValue)
+    {
+        Property* property = m_logicEngine.resolvePropertyPath("my.script.inputs.a.b[0]");
+        ASSERT_NE(nullptr, property);
+        EXPECT_TRUE(property->set<int32_t>(42));
+        EXPECT_EQ(42, *m_script->getInputs()->getChild("a")->getChild("b")->getChild(0u)->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_PropertyPathLookup, FailsToResolveInvalidPaths)
+    {
+        expectError("", "Cannot resolve property path '', expected name of existing logic node followed by '.inputs' or '.outputs'");
+        expectError("unknown.inputs.a", "Cannot resolve property path 'unknown.inputs.a', expected name of existing logic node followed by '.inputs' or '.outputs'");
+        expectError("my.script.in.a", "Cannot resolve property path 'my.script.in.a', expected name of existing logic node followed by '.inputs' or '.outputs'");
+        expectError("my.script.inputsa", "Cannot resolve property path 'my.script.inputsa', expected name of existing logic node followed by '.inputs' or '.outputs'");
+        expectError("my.script.inputs.c", "Cannot resolve property path 'my.script.inputs.c', property '' has no field 'c'");
+        expectError("my.script.inputs.a.", "Cannot resolve property path 'my.script.inputs.a.', property 'a' has no field ''");
+        expectError("my.script.inputs.a.b.c", "Cannot resolve property path 'my.script.inputs.a.b.c', property 'b' has no field 'c'");
+        expectError("my.script.inputs.a.b[4]", "Cannot resolve property path 'my.script.inputs.a.b[4]', property 'b' has no array element with index 4");
+        expectError("my.script.inputs.a[0]", "Cannot resolve property path 'my.script.inputs.a[0]', property 'a' has no array element with index 0");
+        expectError("my.script.inputs.a.b[x]", "Cannot resolve property path 'my.script.inputs.a.b[x]', invalid array index '[x]'");
+        expectError("my.script.inputs.a.b[-1]", "Cannot resolve property path 'my.script.inputs.a.b[-1]', invalid array index '[-1]'");
+        expectError("my.script.inputs.a.b[1", "Cannot resolve property path 'my.script.inputs.a.b[1', invalid array index '[1'");
+        expectError("my.script.inputs.a.b[1]x", "Cannot resolve property path 'my.script.inputs.a.b[1]x', expected '.' or '[' at 'x'");
+    }
+}
@@ -0,0 +1,119 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include <gmock/gmock.h>
+#include "LogicEngineTest_Base.h"
+#include "ramses-logic/Property.h"
+
+namespace rlogic
+{
+    class ALogicEngine_LuaGarbageCollection : public ALogicEngine
+    {
+    protected:
+        LuaScript* createGarbageProducingScript()
+        {
+            // every run creates tables which become garbage immediately
+            return m_logicEngine.createLuaScript(R"(
+                function interface(IN,OUT)
+                    IN.count = Type:Int32()
+                    OUT.sum = Type:Int32()
+                end
+                function run(IN,OUT)
+                    local sum = 0
+                    for i = 1, IN.count do
+                        local t = { value = i }
+                        sum = sum + t.value
+                    end
+                    OUT.sum = sum
+                end
+            )");
+        }
+
+        static int32_t ExpectedSum(int32_t count)
+        {
+            return count * (count + 1) / 2;
+        }
+    };
+
+    TEST_F(ALogicEngine_LuaGarbageCollection, FailsToSetStepMultiplierBelow100Percent)
+    {
+        EXPECT_FALSE(m_logicEngine.setLuaGarbageCollectorParameters(200u, 99u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Invalid Lua garbage collector parameters (pause 200%, step multiplier 99%), step multiplier must be at least 100%!", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_TRUE(m_logicEngine.setLuaGarbageCollectorParameters(100u, 100u));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+    }
+
+    TEST_F(ALogicEngine_LuaGarbageCollection, FinishesCollectionCycleWithinGenerousBudget)
+    {
+        LuaScript* script = createGarbageProducingScript();
+        ASSERT_NE(nullptr, script);
+        script->getInputs()->getChild("count")->set<int32_t>(1000);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_logicEngine.collectLuaGarbage(std::chrono::seconds(10)));
+    }
+
+    TEST_F(ALogicEngine_LuaGarbageCollection, UpdatesScriptsWithAutomaticCollectionDisabledAndCollectsGarbageExplicitly)
+    {
+        m_logicEngine.enableAutomaticLuaGarbageCollection(false);
+        m_logicEngine.enableUpdateReport(true);
+
+        LuaScript* script = createGarbageProducingScript();
+        ASSERT_NE(nullptr, script);
+
+        for (int32_t count : { 1000, 2000, 3000 })
+        {
+            script->getInputs()->getChild("count")->set<int32_t>(count);
+            ASSERT_TRUE(m_logicEngine.update());
+            EXPECT_EQ(ExpectedSum(count), *script->getOutputs()->getChild("sum")->get<int32_t>());
+        }
+        const size_t memoryWithGarbage = m_logicEngine.getLastUpdateReport().getLuaMemoryUsage();
+
+        EXPECT_TRUE(m_logicEngine.collectLuaGarbage(std::chrono::seconds(10)));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_LT(m_logicEngine.getLastUpdateReport().getLuaMemoryUsage(), memoryWithGarbage);
+
+        // automatic collection stays disabled after explicit collection
+        script->getInputs()->getChild("count")->set<int32_t>(4000);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(ExpectedSum(4000), *script->getOutputs()->getChild("sum")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_LuaGarbageCollection, ReportsLuaMemoryUsageOfAllLuaStates)
+    {
+        m_logicEngine.enableUpdateReport(true);
+        ASSERT_TRUE(m_logicEngine.update());
+        const size_t singleStateMemory = m_logicEngine.getLastUpdateReport().getLuaMemoryUsage();
+        EXPECT_GT(singleStateMemory, 0u);
+
+        ASSERT_TRUE(m_logicEngine.setLuaStateCount(3u));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_GT(m_logicEngine.getLastUpdateReport().getLuaMemoryUsage(), singleStateMemory);
+    }
+
+    TEST_F(ALogicEngine_LuaGarbageCollection, ResetsReportedGarbageCollectionTimeAfterUpdate)
+    {
+        m_logicEngine.enableUpdateReport(true);
+
+        m_logicEngine.collectLuaGarbage(std::chrono::seconds(10));
+        ASSERT_TRUE(m_logicEngine.update());
+        // measured time cannot be consistently tested (can be reported as 0 with coarse clock), but must be reset after reporting
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0, m_logicEngine.getLastUpdateReport().getLuaGarbageCollectionTime().count());
+    }
+
+    TEST_F(ALogicEngine_LuaGarbageCollection, ReportIsEmptyIfDisabled)
+    {
+        m_logicEngine.enableUpdateReport(false);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(0u, m_logicEngine.getLastUpdateReport().getLuaMemoryUsage());
+        EXPECT_EQ(0, m_logicEngine.getLastUpdateReport().getLuaGarbageCollectionTime().count());
+    }
+}
@@ -0,0 +1,221 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/LuaModule.h"
+#include "ramses-logic/Property.h"
+#include "impl/LuaScriptImpl.h"
+
+namespace rlogic::internal
+{
+    class ALogicEngine_LuaStates : public ::testing::Test
+    {
+    protected:
+        LuaScript* createScriptUsingModules(LuaModule& quadsModule)
+        {
+            LuaConfig config;
+            config.addDependency("quads", quadsModule);
+            return m_logicEngine.createLuaScript(m_scriptSrc, config);
+        }
+
+        LuaModule* createModules()
+        {
+            LuaConfig config;
+            config.addDependency("mymath", *m_logicEngine.createLuaModule(m_mathSrc, {}, "mathMod"));
+            return m_logicEngine.createLuaModule(m_quadsSrc, config, "quadsMod");
+        }
+
+        LogicEngine m_logicEngine;
+
+        const std::string_view m_mathSrc = R"(
+            local mymath = {}
+            function mymath.add(a,b)
+                return a+b
+            end
+            return mymath
+        )";
+
+        const std::string_view m_quadsSrc = R"(
+            modules("mymath")
+            local quads = {}
+            function quads.twice(a)
+                return mymath.add(a, a)
+            end
+            return quads
+        )";
+
+        const std::string_view m_scriptSrc = R"(
+            modules("quads")
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                OUT.value = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.value = quads.twice(IN.value)
+            end
+        )";
+    };
+
+    TEST_F(ALogicEngine_LuaStates, FailsToSetZeroLuaStates)
+    {
+        EXPECT_FALSE(m_logicEngine.setLuaStateCount(0u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to set Lua state count: at least one Lua state is required!", m_logicEngine.getErrors()[0].message);
+    }
+
+    TEST_F(ALogicEngine_LuaStates, FailsToChangeLuaStateCountWhenLuaObjectsExist)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(m_mathSrc);
+        ASSERT_NE(nullptr, module);
+
+        EXPECT_FALSE(m_logicEngine.setLuaStateCount(2u));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to set Lua state count: it can only be changed while there are no Lua scripts, modules and interfaces!", m_logicEngine.getErrors()[0].message);
+
+        ASSERT_TRUE(m_logicEngine.destroy(*module));
+        EXPECT_TRUE(m_logicEngine.setLuaStateCount(2u));
+    }
+
+    TEST_F(ALogicEngine_LuaStates, DistributesScriptsOverLuaStatesAndLoadsUsedModulesIntoEachOfThem)
+    {
+        ASSERT_TRUE(m_logicEngine.setLuaStateCount(3u));
+        LuaModule* quadsModule = createModules();
+        ASSERT_NE(nullptr, quadsModule);
+
+        std::vector<LuaScript*> scripts;
+        for (int32_t i = 0; i < 4; ++i)
+        {
+            scripts.push_back(createScriptUsingModules(*quadsModule));
+            ASSERT_NE(nullptr, scripts.back());
+            EXPECT_TRUE(scripts.back()->getInputs()->getChild("value")->set<int32_t>(i));
+        }
+
+        // round-robin, 4th script shares state with 1st
+        EXPECT_NE(&scripts[0]->m_script.getSolState(), &scripts[1]->m_script.getSolState());
+        EXPECT_NE(&scripts[1]->m_script.getSolState(), &scripts[2]->m_script.getSolState());
+        EXPECT_NE(&scripts[0]->m_script.getSolState(), &scripts[2]->m_script.getSolState());
+        EXPECT_EQ(&scripts[0]->m_script.getSolState(), &scripts[3]->m_script.getSolState());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        for (int32_t i = 0; i < 4; ++i)
+            EXPECT_EQ(2 * i, *scripts[static_cast<size_t>(i)]->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_LuaStates, FailedScriptCreationDoesNotTakeTurnInRoundRobin)
+    {
+        ASSERT_TRUE(m_logicEngine.setLuaStateCount(2u));
+        LuaModule* quadsModule = createModules();
+        ASSERT_NE(nullptr, quadsModule);
+
+        LuaScript* script1 = createScriptUsingModules(*quadsModule);
+        ASSERT_NE(nullptr, script1);
+        EXPECT_EQ(nullptr, m_logicEngine.createLuaScript("this is not Lua"));
+        LuaScript* script2 = createScriptUsingModules(*quadsModule);
+        ASSERT_NE(nullptr, script2);
+
+        EXPECT_NE(&script1->m_script.getSolState(), &script2->m_script.getSolState());
+    }
+
+    TEST_F(ALogicEngine_LuaStates, ExecutesScriptsOfDifferentLuaStatesConcurrently_WithSameResultsAsSerialUpdate)
+    {
+        ASSERT_TRUE(m_logicEngine.setLuaStateCount(4u));
+        LuaModule* quadsModule = createModules();
+        ASSERT_NE(nullptr, quadsModule);
+
+        // two levels of independent scripts, each script of second level consumes output of one script of first level
+        std::vector<LuaScript*> producers;
+        std::vector<LuaScript*> consumers;
+        for (size_t i = 0u; i < 16u; ++i)
+        {
+            producers.push_back(createScriptUsingModules(*quadsModule));
+            consumers.push_back(createScriptUsingModules(*quadsModule));
+            ASSERT_TRUE(m_logicEngine.link(*producers.back()->getOutputs()->getChild("value"), *consumers.back()->getInputs()->getChild("value")));
+        }
+
+        m_logicEngine.setParallelUpdateWorkerCount(3u);
+        for (int32_t value : { 1, 2, 5 })
+        {
+            for (size_t i = 0u; i < producers.size(); ++i)
+                producers[i]->getInputs()->getChild("value")->set<int32_t>(value + static_cast<int32_t>(i));
+
+            ASSERT_TRUE(m_logicEngine.update());
+            for (size_t i = 0u; i < consumers.size(); ++i)
+                EXPECT_EQ(4 * (value + static_cast<int32_t>(i)), *consumers[i]->getOutputs()->getChild("value")->get<int32_t>());
+        }
+
+        m_logicEngine.setParallelUpdateWorkerCount(0u);
+        producers[0]->getInputs()->getChild("value")->set<int32_t>(10);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(40, *consumers[0]->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_LuaStates, ReportsRuntimeErrorOfScriptExecutedConcurrently)
+    {
+        ASSERT_TRUE(m_logicEngine.setLuaStateCount(2u));
+        m_logicEngine.setParallelUpdateWorkerCount(1u);
+
+        const std::string_view failingSrc = R"(
+            function interface(IN,OUT)
+                IN.fail = Type:Bool()
+            end
+            function run(IN,OUT)
+                if IN.fail then
+                    error("failing on purpose")
+                end
+            end
+        )";
+        LuaScript* script1 = m_logicEngine.createLuaScript(failingSrc, {}, "script1");
+        LuaScript* script2 = m_logicEngine.createLuaScript(failingSrc, {}, "script2");
+        ASSERT_TRUE(script1 && script2);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        script2->getInputs()->getChild("fail")->set(true);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_THAT(m_logicEngine.getErrors()[0].message, ::testing::HasSubstr("failing on purpose"));
+        EXPECT_EQ(script2, m_logicEngine.getErrors()[0].object);
+    }
+
+    TEST_F(ALogicEngine_LuaStates, KeepsLuaStateCountWhenLoadingFile)
+    {
+        WithTempDirectory tempDir;
+        {
+            LogicEngine otherEngine;
+            LuaConfig config;
+            config.addDependency("mymath", *otherEngine.createLuaModule(m_mathSrc, {}, "mathMod"));
+            LuaModule* quadsModule = otherEngine.createLuaModule(m_quadsSrc, config, "quadsMod");
+            LuaConfig scriptConfig;
+            scriptConfig.addDependency("quads", *quadsModule);
+            otherEngine.createLuaScript(m_scriptSrc, scriptConfig, "script1");
+            otherEngine.createLuaScript(m_scriptSrc, scriptConfig, "script2");
+            ASSERT_TRUE(otherEngine.saveToFile("luaStates.rlogic"));
+        }
+
+        ASSERT_TRUE(m_logicEngine.setLuaStateCount(2u));
+        ASSERT_TRUE(m_logicEngine.loadFromFile("luaStates.rlogic"));
+
+        LuaScript* script1 = m_logicEngine.findByName<LuaScript>("script1");
+        LuaScript* script2 = m_logicEngine.findByName<LuaScript>("script2");
+        ASSERT_TRUE(script1 && script2);
+        EXPECT_NE(&script1->m_script.getSolState(), &script2->m_script.getSolState());
+
+        script1->getInputs()->getChild("value")->set<int32_t>(3);
+        script2->getInputs()->getChild("value")->set<int32_t>(4);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(6, *script1->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(8, *script2->getOutputs()->getChild("value")->get<int32_t>());
+
+        // Lua objects exist after loading, state count can't be changed anymore
+        EXPECT_FALSE(m_logicEngine.setLuaStateCount(1u));
+    }
+}
@@ -1209,6 +1209,28 @@ namespace rlogic::internal
         }
     }
 
+    TEST_P(ALogicEngine_Serialization, persistsUpdateRateDivisors)
+    {
+        {
+            LogicEngine logicEngine{ GetParam() };
+            auto* luaScript = logicEngine.createLuaScript(m_valid_empty_script, {}, "script");
+            auto* nodeBinding = logicEngine.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "nodeBinding");
+            logicEngine.createTimerNode("timerNode");
+
+            EXPECT_TRUE(luaScript->setUpdateRateDivisor(2u));
+            EXPECT_TRUE(nodeBinding->setUpdateRateDivisor(5u));
+
+            ASSERT_TRUE(SaveToFileWithoutValidation(logicEngine, "LogicEngine.bin"));
+        }
+
+        EXPECT_TRUE(m_logicEngine.loadFromFile("LogicEngine.bin", m_scene));
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+
+        EXPECT_EQ(2u, m_logicEngine.findByName<LuaScript>("script")->getUpdateRateDivisor());
+        EXPECT_EQ(5u, m_logicEngine.findByName<RamsesNodeBinding>("nodeBinding")->getUpdateRateDivisor());
+        EXPECT_EQ(1u, m_logicEngine.findByName<TimerNode>("timerNode")->getUpdateRateDivisor());
+    }
+
     TEST_P(ALogicEngine_Serialization, persistsLogicObjectImplToHLObjectMapping)
     {
         const auto objects = saveAndLoadAllTypesOfObjects();
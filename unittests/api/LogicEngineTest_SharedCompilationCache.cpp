@@ -0,0 +1,249 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "WithTempDirectory.h"
+
+#include "ramses-logic/LogicEngine.h"
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/LuaModule.h"
+#include "ramses-logic/Property.h"
+#include "ramses-logic/SaveFileConfig.h"
+#include "internals/LuaCompilationCache.h"
+
+namespace rlogic::internal
+{
+    class ALogicEngine_SharedCompilationCache : public ::testing::Test
+    {
+    protected:
+        ALogicEngine_SharedCompilationCache()
+        {
+            LogicEngine::ClearSharedLuaCompilationCache();
+            m_logicEngine.enableSharedLuaCompilationCache(true);
+            m_otherLogicEngine.enableSharedLuaCompilationCache(true);
+        }
+
+        ~ALogicEngine_SharedCompilationCache() override
+        {
+            LogicEngine::ClearSharedLuaCompilationCache();
+        }
+
+        static size_t CacheEntryCount()
+        {
+            return LuaCompilationCache::Get().getEntryCount();
+        }
+
+        LuaScript* createScriptUsingModule(LogicEngine& logicEngine)
+        {
+            LuaConfig config;
+            config.addDependency("mymath", *logicEngine.createLuaModule(m_mathSrc, {}, "mathMod"));
+            return logicEngine.createLuaScript(m_scriptWithModuleSrc, config, "script");
+        }
+
+        LogicEngine m_logicEngine{ EFeatureLevel_02 };
+        LogicEngine m_otherLogicEngine{ EFeatureLevel_02 };
+
+        const std::string_view m_scriptSrc = R"(
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                IN.nested = { flag = Type:Bool(), values = Type:Array(2, Type:Float()) }
+                OUT.value = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.value = IN.value * 3
+            end
+        )";
+
+        const std::string_view m_mathSrc = R"(
+            local mymath = {}
+            function mymath.add(a,b)
+                return a+b
+            end
+            return mymath
+        )";
+
+        const std::string_view m_scriptWithModuleSrc = R"(
+            modules("mymath")
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                OUT.value = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.value = mymath.add(IN.value, IN.value)
+            end
+        )";
+    };
+
+    TEST_F(ALogicEngine_SharedCompilationCache, CompilesSameScriptOnlyOnceForAllLogicEngines)
+    {
+        LuaScript* script = m_logicEngine.createLuaScript(m_scriptSrc, {}, "script");
+        ASSERT_NE(nullptr, script);
+        EXPECT_EQ(1u, CacheEntryCount());
+
+        LuaScript* otherScript = m_otherLogicEngine.createLuaScript(m_scriptSrc, {}, "script");
+        ASSERT_NE(nullptr, otherScript);
+        EXPECT_EQ(1u, CacheEntryCount());
+
+        // interface taken from cache is equal to extracted one
+        ASSERT_EQ(2u, otherScript->getInputs()->getChildCount());
+        ASSERT_NE(nullptr, otherScript->getInputs()->getChild("nested"));
+        EXPECT_EQ(EPropertyType::Array, otherScript->getInputs()->getChild("nested")->getChild("values")->getType());
+        EXPECT_EQ(2u, otherScript->getInputs()->getChild("nested")->getChild("values")->getChildCount());
+        EXPECT_EQ(EPropertyType::Bool, otherScript->getInputs()->getChild("nested")->getChild("flag")->getType());
+        ASSERT_EQ(1u, otherScript->getOutputs()->getChildCount());
+
+        EXPECT_TRUE(otherScript->getInputs()->getChild("value")->set<int32_t>(5));
+        ASSERT_TRUE(m_otherLogicEngine.update());
+        EXPECT_EQ(15, *otherScript->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, CachesModulesAndScriptsUsingThem)
+    {
+        ASSERT_NE(nullptr, createScriptUsingModule(m_logicEngine));
+        EXPECT_EQ(2u, CacheEntryCount());
+
+        LuaScript* otherScript = createScriptUsingModule(m_otherLogicEngine);
+        ASSERT_NE(nullptr, otherScript);
+        EXPECT_EQ(2u, CacheEntryCount());
+
+        EXPECT_TRUE(otherScript->getInputs()->getChild("value")->set<int32_t>(4));
+        ASSERT_TRUE(m_otherLogicEngine.update());
+        EXPECT_EQ(8, *otherScript->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, ReportsErrorForMismatchingModulesAlsoWhenCompiledScriptIsCached)
+    {
+        ASSERT_NE(nullptr, createScriptUsingModule(m_logicEngine));
+
+        EXPECT_EQ(nullptr, m_otherLogicEngine.createLuaScript(m_scriptWithModuleSrc, {}, "script"));
+        ASSERT_EQ(1u, m_otherLogicEngine.getErrors().size());
+        EXPECT_THAT(m_otherLogicEngine.getErrors()[0].message, ::testing::HasSubstr("Module dependencies declared in source code do not match those provided by LuaConfig"));
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, DistinguishesSourcesByFeatureLevelAndStandardModules)
+    {
+        LogicEngine engineFeatureLevel1{ EFeatureLevel_01 };
+        engineFeatureLevel1.enableSharedLuaCompilationCache(true);
+
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(m_scriptSrc));
+        ASSERT_NE(nullptr, engineFeatureLevel1.createLuaScript(m_scriptSrc));
+        EXPECT_EQ(2u, CacheEntryCount());
+
+        LuaConfig config;
+        config.addStandardModuleDependency(EStandardModule::Math);
+        ASSERT_NE(nullptr, m_otherLogicEngine.createLuaScript(m_scriptSrc, config));
+        EXPECT_EQ(3u, CacheEntryCount());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, DoesNotCacheScriptsWithErrors)
+    {
+        EXPECT_EQ(nullptr, m_logicEngine.createLuaScript(R"(
+            function interface(IN,OUT)
+            end
+        )"));
+        EXPECT_EQ(0u, CacheEntryCount());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, DoesNotUseCacheIfDisabled)
+    {
+        LogicEngine engineWithoutCache{ EFeatureLevel_02 };
+        ASSERT_NE(nullptr, engineWithoutCache.createLuaScript(m_scriptSrc));
+        EXPECT_EQ(0u, CacheEntryCount());
+
+        m_logicEngine.enableSharedLuaCompilationCache(false);
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(m_scriptSrc));
+        EXPECT_EQ(0u, CacheEntryCount());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, UsesCacheWhenLoadingScriptsSavedAsSourceCode)
+    {
+        WithTempDirectory tempDir;
+        {
+            LogicEngine savingEngine{ EFeatureLevel_02 };
+            savingEngine.createLuaScript(m_scriptSrc, {}, "script");
+            SaveFileConfig config;
+            config.setLuaSavingMode(ELuaSavingMode::SourceCodeOnly);
+            ASSERT_TRUE(savingEngine.saveToFile("sourceOnly.rlogic", config));
+        }
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("sourceOnly.rlogic"));
+        EXPECT_EQ(1u, CacheEntryCount());
+        ASSERT_TRUE(m_otherLogicEngine.loadFromFile("sourceOnly.rlogic"));
+        EXPECT_EQ(1u, CacheEntryCount());
+
+        LuaScript* script = m_otherLogicEngine.findByName<LuaScript>("script");
+        ASSERT_NE(nullptr, script);
+        EXPECT_TRUE(script->getInputs()->getChild("value")->set<int32_t>(2));
+        ASSERT_TRUE(m_otherLogicEngine.update());
+        EXPECT_EQ(6, *script->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, RemovesEntryWhenLastLuaObjectCompiledWithItIsDestroyed)
+    {
+        LuaScript* script = m_logicEngine.createLuaScript(m_scriptSrc);
+        LuaScript* otherScript = m_otherLogicEngine.createLuaScript(m_scriptSrc);
+        ASSERT_TRUE(script && otherScript);
+        EXPECT_EQ(1u, CacheEntryCount());
+
+        ASSERT_TRUE(m_logicEngine.destroy(*script));
+        EXPECT_EQ(1u, CacheEntryCount());
+        ASSERT_TRUE(m_otherLogicEngine.destroy(*otherScript));
+        EXPECT_EQ(0u, CacheEntryCount());
+
+        // compiled again and cached when needed again
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(m_scriptSrc));
+        EXPECT_EQ(1u, CacheEntryCount());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, KeepsEntryOfModuleWhileModuleExists)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(m_mathSrc, {}, "mathMod");
+        ASSERT_NE(nullptr, module);
+        EXPECT_EQ(1u, CacheEntryCount());
+
+        ASSERT_TRUE(m_logicEngine.destroy(*module));
+        EXPECT_EQ(0u, CacheEntryCount());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, KeepsEntryWhileScriptInstanceUsesSameCode)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSrc);
+        ASSERT_NE(nullptr, prototype);
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance);
+
+        ASSERT_TRUE(m_logicEngine.destroy(*prototype));
+        EXPECT_EQ(1u, CacheEntryCount());
+        ASSERT_TRUE(m_logicEngine.destroy(*instance));
+        EXPECT_EQ(0u, CacheEntryCount());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, RemovesEntriesWhenLogicEngineIsDestroyed)
+    {
+        {
+            LogicEngine engine{ EFeatureLevel_02 };
+            engine.enableSharedLuaCompilationCache(true);
+            ASSERT_NE(nullptr, createScriptUsingModule(engine));
+            EXPECT_EQ(2u, CacheEntryCount());
+        }
+        EXPECT_EQ(0u, CacheEntryCount());
+    }
+
+    TEST_F(ALogicEngine_SharedCompilationCache, ClearsCache)
+    {
+        ASSERT_NE(nullptr, m_logicEngine.createLuaScript(m_scriptSrc));
+        EXPECT_EQ(1u, CacheEntryCount());
+
+        LogicEngine::ClearSharedLuaCompilationCache();
+        EXPECT_EQ(0u, CacheEntryCount());
+
+        // existing script not affected
+        ASSERT_TRUE(m_logicEngine.update());
+    }
+}
@@ -11,6 +11,7 @@
 #include "LogicEngineTest_Base.h"
 
 #include "RamsesTestUtils.h"
+#include "WithTempDirectory.h"
 
 #include "ramses-logic/RamsesAppearanceBinding.h"
 #include "ramses-logic/RamsesNodeBinding.h"
@@ -30,6 +31,10 @@
 
 #include "fmt/format.h"
 
+#include <limits>
+#include <atomic>
+#include <thread>
+
 namespace rlogic
 {
     class ALogicEngine_Update : public ALogicEngine
@@ -473,4 +478,749 @@ namespace rlogic
         EXPECT_EQ(sourceScript, executedNodes[0].first);
         EXPECT_EQ(targetScript, executedNodes[1].first);
     }
+
+    TEST_F(ALogicEngine_Update, ExecutesNodeSetDirtyOverWeakLinkInNextUpdate)
+    {
+        auto scriptSource = R"(
+            function interface(IN,OUT)
+                IN.in1 = Type:Int32()
+                IN.in2 = Type:Int32()
+                OUT.out = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.out = IN.in1 + IN.in2
+            end
+        )";
+
+        auto s1 = m_logicEngine.createLuaScript(scriptSource, {}, "s1");
+        auto s2 = m_logicEngine.createLuaScript(scriptSource, {}, "s2");
+
+        // s1 -> s2 -(weak)-> s1
+        ASSERT_TRUE(m_logicEngine.link(*s1->getOutputs()->getChild("out"), *s2->getInputs()->getChild("in1")));
+        ASSERT_TRUE(m_logicEngine.linkWeak(*s2->getOutputs()->getChild("out"), *s1->getInputs()->getChild("in2")));
+
+        m_logicEngine.enableUpdateReport(true);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_logicEngine.getLastUpdateReport().getNodesExecuted().size());
+
+        s2->getInputs()->getChild("in2")->set(1);
+        ASSERT_TRUE(m_logicEngine.update());
+        auto executedNodes = m_logicEngine.getLastUpdateReport().getNodesExecuted();
+        ASSERT_EQ(1u, executedNodes.size());
+        EXPECT_EQ(s2, executedNodes[0].first);
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::ElementsAre(s1));
+
+        // s1 got new value over weak link in previous update
+        ASSERT_TRUE(m_logicEngine.update());
+        executedNodes = m_logicEngine.getLastUpdateReport().getNodesExecuted();
+        ASSERT_EQ(2u, executedNodes.size());
+        EXPECT_EQ(s1, executedNodes[0].first);
+        EXPECT_EQ(s2, executedNodes[1].first);
+        EXPECT_EQ(1, *s1->getOutputs()->getChild("out")->get<int32_t>());
+        EXPECT_EQ(2, *s2->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_Update, OnlyUpdatesDirtyLogicNodesAfterOtherNodeWasDestroyed)
+    {
+        auto scriptSource = R"(
+            function interface(IN,OUT)
+                IN.in1 = Type:Int32()
+                OUT.out = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.out = IN.in1
+            end
+        )";
+
+        std::array<LuaScript*, 4> s = {};
+        for (auto& si : s)
+            si = m_logicEngine.createLuaScript(scriptSource);
+        ASSERT_TRUE(m_logicEngine.link(*s[2]->getOutputs()->getChild("out"), *s[3]->getInputs()->getChild("in1")));
+
+        m_logicEngine.enableUpdateReport(true);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(4u, m_logicEngine.getLastUpdateReport().getNodesExecuted().size());
+
+        ASSERT_TRUE(m_logicEngine.destroy(*s[0]));
+        s[2]->getInputs()->getChild("in1")->set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        const auto executedNodes = m_logicEngine.getLastUpdateReport().getNodesExecuted();
+        ASSERT_EQ(2u, executedNodes.size());
+        EXPECT_EQ(s[2], executedNodes[0].first);
+        EXPECT_EQ(s[3], executedNodes[1].first);
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::ElementsAre(s[1]));
+        EXPECT_EQ(5, *s[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    class ALogicEngine_UpdateWithBudget : public ALogicEngine_Update
+    {
+    protected:
+        ALogicEngine_UpdateWithBudget()
+        {
+            for (auto& script : m_scripts)
+                script = m_logicEngine.createLuaScript(m_scriptSource);
+            m_logicEngine.enableUpdateReport(true);
+        }
+
+        // s0 -> s1 -> s2 -> s3
+        void linkScriptsToChain()
+        {
+            for (size_t i = 1u; i < m_scripts.size(); ++i)
+                ASSERT_TRUE(m_logicEngine.link(*m_scripts[i - 1]->getOutputs()->getChild("out"), *m_scripts[i]->getInputs()->getChild("in1")));
+        }
+
+        [[nodiscard]] std::vector<const LogicNode*> getExecutedNodes() const
+        {
+            std::vector<const LogicNode*> executedNodes;
+            for (const auto& node : m_logicEngine.getLastUpdateReport().getNodesExecuted())
+                executedNodes.push_back(node.first);
+            return executedNodes;
+        }
+
+        static constexpr std::chrono::microseconds UnlimitedTime = std::chrono::microseconds::max();
+
+        const std::string_view m_scriptSource = R"(
+            function interface(IN,OUT)
+                IN.in1 = Type:Int32()
+                OUT.out = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.out = IN.in1
+            end
+        )";
+        std::array<LuaScript*, 4> m_scripts = {};
+    };
+
+    TEST_F(ALogicEngine_UpdateWithBudget, SpreadsUpdateOverSeveralCallsIfNodeBudgetIsExhausted)
+    {
+        linkScriptsToChain();
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        bool updateCompleted = true;
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 2u, updateCompleted));
+        EXPECT_FALSE(updateCompleted);
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0], m_scripts[1]));
+        // s3 is not known to need update yet
+        EXPECT_EQ(1u, m_logicEngine.getLastUpdateReport().getDeferredNodeCount());
+        EXPECT_EQ(0, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 2u, updateCompleted));
+        EXPECT_TRUE(updateCompleted);
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[2], m_scripts[3]));
+        EXPECT_EQ(0u, m_logicEngine.getLastUpdateReport().getDeferredNodeCount());
+        EXPECT_EQ(5, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_UpdateWithBudget, ExecutesAtLeastOneNodeIfTimeBudgetIsExhausted)
+    {
+        bool updateCompleted = true;
+        for (size_t i = 0u; i < m_scripts.size(); ++i)
+        {
+            ASSERT_TRUE(m_logicEngine.updateWithBudget(std::chrono::microseconds{ 0 }, std::numeric_limits<size_t>::max(), updateCompleted));
+            EXPECT_EQ(1u, m_logicEngine.getLastUpdateReport().getNodesExecuted().size());
+            EXPECT_EQ(m_scripts.size() - i - 1u, m_logicEngine.getLastUpdateReport().getDeferredNodeCount());
+        }
+        EXPECT_TRUE(updateCompleted);
+    }
+
+    TEST_F(ALogicEngine_UpdateWithBudget, CompletesUpdateInOneCallIfBudgetIsSufficient)
+    {
+        linkScriptsToChain();
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+
+        bool updateCompleted = false;
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, std::numeric_limits<size_t>::max(), updateCompleted));
+        EXPECT_TRUE(updateCompleted);
+        EXPECT_EQ(4u, m_logicEngine.getLastUpdateReport().getNodesExecuted().size());
+        EXPECT_EQ(5, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_UpdateWithBudget, ContinuesInterruptedUpdateAtPositionWhereItStopped)
+    {
+        ASSERT_TRUE(m_logicEngine.update());
+        for (auto& script : m_scripts)
+            script->getInputs()->getChild("in1")->set(1);
+
+        bool updateCompleted = true;
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 2u, updateCompleted));
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0], m_scripts[1]));
+
+        // already executed node is dirty again, it will be executed after the interrupted update completes
+        m_scripts[0]->getInputs()->getChild("in1")->set(2);
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 2u, updateCompleted));
+        EXPECT_TRUE(updateCompleted);
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[2], m_scripts[3]));
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 2u, updateCompleted));
+        EXPECT_TRUE(updateCompleted);
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0]));
+        EXPECT_EQ(2, *m_scripts[0]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_UpdateWithBudget, UpdateWithoutBudgetExecutesAllRemainingNodes)
+    {
+        linkScriptsToChain();
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+
+        bool updateCompleted = true;
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 1u, updateCompleted));
+        EXPECT_FALSE(updateCompleted);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[1], m_scripts[2], m_scripts[3]));
+        EXPECT_EQ(0u, m_logicEngine.getLastUpdateReport().getDeferredNodeCount());
+        EXPECT_EQ(5, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_UpdateWithBudget, RestartsInterruptedUpdateAfterNodeWasDestroyed)
+    {
+        linkScriptsToChain();
+        ASSERT_TRUE(m_logicEngine.update());
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+
+        bool updateCompleted = true;
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 1u, updateCompleted));
+        EXPECT_FALSE(updateCompleted);
+
+        // ranks of nodes change, interrupted update starts over with nodes which are still dirty
+        ASSERT_TRUE(m_logicEngine.destroy(*m_scripts[3]));
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 10u, updateCompleted));
+        EXPECT_TRUE(updateCompleted);
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[1], m_scripts[2]));
+        EXPECT_EQ(5, *m_scripts[2]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    class ALogicEngine_UpdateOfRequiredOutputs : public ALogicEngine_UpdateWithBudget
+    {
+    protected:
+        // s0 -> s1    s2 -> s3
+        void linkScriptsToTwoChains()
+        {
+            ASSERT_TRUE(m_logicEngine.link(*m_scripts[0]->getOutputs()->getChild("out"), *m_scripts[1]->getInputs()->getChild("in1")));
+            ASSERT_TRUE(m_logicEngine.link(*m_scripts[2]->getOutputs()->getChild("out"), *m_scripts[3]->getInputs()->getChild("in1")));
+        }
+    };
+
+    TEST_F(ALogicEngine_UpdateOfRequiredOutputs, ExecutesOnlyDirtyNodesRequiredForGivenOutputs)
+    {
+        linkScriptsToTwoChains();
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(1);
+        m_scripts[2]->getInputs()->getChild("in1")->set(2);
+        ASSERT_TRUE(m_logicEngine.update({ m_scripts[1]->getOutputs()->getChild("out") }));
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0], m_scripts[1]));
+        EXPECT_EQ(1u, m_logicEngine.getLastUpdateReport().getDeferredNodeCount());
+        EXPECT_EQ(1, *m_scripts[1]->getOutputs()->getChild("out")->get<int32_t>());
+        EXPECT_EQ(0, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+
+        // other nodes are executed in next full update
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[2], m_scripts[3]));
+        EXPECT_EQ(2, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_UpdateOfRequiredOutputs, DoesNotExecuteDownstreamNodesOfRequiredOutputs)
+    {
+        linkScriptsToTwoChains();
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_scripts[2]->getInputs()->getChild("in1")->set(2);
+        ASSERT_TRUE(m_logicEngine.update({ m_scripts[2]->getOutputs()->getChild("out") }));
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[2]));
+        EXPECT_EQ(2, *m_scripts[2]->getOutputs()->getChild("out")->get<int32_t>());
+
+        // value was propagated to s3 already
+        EXPECT_EQ(2, *m_scripts[3]->getInputs()->getChild("in1")->get<int32_t>());
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[3]));
+    }
+
+    TEST_F(ALogicEngine_UpdateOfRequiredOutputs, ExecutesNothingIfRequiredNodesAreNotDirty)
+    {
+        linkScriptsToTwoChains();
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_scripts[2]->getInputs()->getChild("in1")->set(2);
+        ASSERT_TRUE(m_logicEngine.update({ m_scripts[1]->getOutputs()->getChild("out"), m_scripts[0]->getOutputs()->getChild("out") }));
+        EXPECT_TRUE(getExecutedNodes().empty());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::ElementsAre(m_scripts[0], m_scripts[1]));
+    }
+
+    TEST_F(ALogicEngine_UpdateOfRequiredOutputs, FailsIfPropertyDoesNotBelongToThisLogicEngine)
+    {
+        LogicEngine otherEngine;
+        const auto* otherScript = otherEngine.createLuaScript(m_scriptSource, {}, "otherScript");
+
+        EXPECT_FALSE(m_logicEngine.update({ otherScript->getOutputs()->getChild("out") }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot update logic nodes required for property 'out', LogicNode 'otherScript' is not an instance of this LogicEngine", m_logicEngine.getErrors()[0].message);
+
+        EXPECT_FALSE(m_logicEngine.update({ nullptr }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot update logic nodes required for a null property", m_logicEngine.getErrors()[0].message);
+    }
+
+    class ALogicEngine_UpdateRateDivisor : public ALogicEngine_UpdateWithBudget
+    {
+    };
+
+    TEST_F(ALogicEngine_UpdateRateDivisor, ExecutesDirtyNodeOnlyInEveryNthUpdate)
+    {
+        EXPECT_EQ(1u, m_scripts[0]->getUpdateRateDivisor());
+        EXPECT_TRUE(m_scripts[0]->setUpdateRateDivisor(3u));
+        EXPECT_EQ(3u, m_scripts[0]->getUpdateRateDivisor());
+
+        // first update executes all nodes
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(4u, getExecutedNodes().size());
+
+        for (int32_t i = 1; i <= 6; ++i)
+        {
+            m_scripts[0]->getInputs()->getChild("in1")->set(i);
+            ASSERT_TRUE(m_logicEngine.update());
+            if (i % 3 == 0)
+            {
+                EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0]));
+                EXPECT_EQ(i, *m_scripts[0]->getOutputs()->getChild("out")->get<int32_t>());
+            }
+            else
+            {
+                EXPECT_TRUE(getExecutedNodes().empty());
+                EXPECT_EQ(i - i % 3, *m_scripts[0]->getOutputs()->getChild("out")->get<int32_t>());
+            }
+        }
+    }
+
+    TEST_F(ALogicEngine_UpdateRateDivisor, LinkedNodesReceiveValuesOnlyWhenNodeWithLowerRateIsExecuted)
+    {
+        linkScriptsToChain();
+        ASSERT_TRUE(m_scripts[0]->setUpdateRateDivisor(2u));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(getExecutedNodes().empty());
+        EXPECT_EQ(0, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0], m_scripts[1], m_scripts[2], m_scripts[3]));
+        EXPECT_EQ(5, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_UpdateRateDivisor, IgnoresUpdateRateWhenUpdatingNodesRequiredForGivenOutputs)
+    {
+        ASSERT_TRUE(m_scripts[0]->setUpdateRateDivisor(2u));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        ASSERT_TRUE(m_logicEngine.update({ m_scripts[0]->getOutputs()->getChild("out") }));
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0]));
+        EXPECT_EQ(5, *m_scripts[0]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_UpdateRateDivisor, RejectsZeroDivisor)
+    {
+        EXPECT_FALSE(m_scripts[0]->setUpdateRateDivisor(0u));
+        EXPECT_EQ(1u, m_scripts[0]->getUpdateRateDivisor());
+    }
+
+    class ALogicEngine_ParallelUpdate : public ALogicEngine_UpdateWithBudget
+    {
+    protected:
+        ALogicEngine_ParallelUpdate()
+        {
+            m_logicEngine.setParallelUpdateWorkerCount(2u);
+        }
+    };
+
+    TEST_F(ALogicEngine_ParallelUpdate, ExecutesOnlyDirtyNodesAndNodesSetDirtyByLinks)
+    {
+        // s0 -> s1    s2 -> s3
+        ASSERT_TRUE(m_logicEngine.link(*m_scripts[0]->getOutputs()->getChild("out"), *m_scripts[1]->getInputs()->getChild("in1")));
+        ASSERT_TRUE(m_logicEngine.link(*m_scripts[2]->getOutputs()->getChild("out"), *m_scripts[3]->getInputs()->getChild("in1")));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(4u, getExecutedNodes().size());
+
+        m_scripts[2]->getInputs()->getChild("in1")->set(7);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[2], m_scripts[3]));
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::ElementsAre(m_scripts[0], m_scripts[1]));
+        EXPECT_EQ(7, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(getExecutedNodes().empty());
+        EXPECT_EQ(4u, m_logicEngine.getLastUpdateReport().getNodesSkippedExecution().size());
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, ExecutesNodeSetDirtyOverWeakLinkInNextUpdate)
+    {
+        const auto scriptSource = R"(
+            function interface(IN,OUT)
+                IN.in1 = Type:Int32()
+                IN.in2 = Type:Int32()
+                OUT.out = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.out = IN.in1 + IN.in2
+            end
+        )";
+        auto s1 = m_logicEngine.createLuaScript(scriptSource, {}, "s1");
+        auto s2 = m_logicEngine.createLuaScript(scriptSource, {}, "s2");
+
+        // s1 -> s2 -(weak)-> s1
+        ASSERT_TRUE(m_logicEngine.link(*s1->getOutputs()->getChild("out"), *s2->getInputs()->getChild("in1")));
+        ASSERT_TRUE(m_logicEngine.linkWeak(*s2->getOutputs()->getChild("out"), *s1->getInputs()->getChild("in2")));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        s2->getInputs()->getChild("in2")->set(1);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(s2));
+
+        // s1 got new value over weak link in previous update
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(s1, s2));
+        EXPECT_EQ(1, *s1->getOutputs()->getChild("out")->get<int32_t>());
+        EXPECT_EQ(2, *s2->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, KeepsNodeOfLowerUpdateRateDirtyUntilItsUpdateIsDue)
+    {
+        linkScriptsToChain();
+        ASSERT_TRUE(m_scripts[0]->setUpdateRateDivisor(2u));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(getExecutedNodes().empty());
+        EXPECT_EQ(0, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0], m_scripts[1], m_scripts[2], m_scripts[3]));
+        EXPECT_EQ(5, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, SeparatesLevelsOfNodesLinkedInAgreementWithTheirOrder)
+    {
+        // all scripts are independent (same level) and ordered by creation
+        ASSERT_TRUE(m_logicEngine.update());
+
+        // s0 -> s1 does not change the order, but s1 is in a later level now
+        ASSERT_TRUE(m_logicEngine.link(*m_scripts[0]->getOutputs()->getChild("out"), *m_scripts[1]->getInputs()->getChild("in1")));
+        m_scripts[0]->getInputs()->getChild("in1")->set(6);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0], m_scripts[1]));
+        EXPECT_EQ(6, *m_scripts[1]->getOutputs()->getChild("out")->get<int32_t>());
+
+        // same result as serial update
+        ASSERT_TRUE(m_logicEngine.link(*m_scripts[2]->getOutputs()->getChild("out"), *m_scripts[3]->getInputs()->getChild("in1")));
+        m_scripts[2]->getInputs()->getChild("in1")->set(8);
+        LogicEngine serialEngine;
+        std::array<LuaScript*, 4> serialScripts = {};
+        for (auto& script : serialScripts)
+            script = serialEngine.createLuaScript(m_scriptSource);
+        ASSERT_TRUE(serialEngine.update());
+        ASSERT_TRUE(serialEngine.link(*serialScripts[2]->getOutputs()->getChild("out"), *serialScripts[3]->getInputs()->getChild("in1")));
+        serialScripts[2]->getInputs()->getChild("in1")->set(8);
+
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(serialEngine.update());
+        for (size_t i = 2u; i < m_scripts.size(); ++i)
+            EXPECT_EQ(*serialScripts[i]->getOutputs()->getChild("out")->get<int32_t>(), *m_scripts[i]->getOutputs()->getChild("out")->get<int32_t>());
+        EXPECT_EQ(8, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, LeavesNoExecutedNodeForSerialUpdate)
+    {
+        linkScriptsToChain();
+        m_scripts[0]->getInputs()->getChild("in1")->set(3);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0], m_scripts[1], m_scripts[2], m_scripts[3]));
+        EXPECT_EQ(3, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+
+        m_logicEngine.setParallelUpdateWorkerCount(0u);
+        ASSERT_TRUE(m_logicEngine.update({ m_scripts[1]->getOutputs()->getChild("out") }));
+        EXPECT_TRUE(getExecutedNodes().empty());
+        EXPECT_EQ(0u, m_logicEngine.getLastUpdateReport().getDeferredNodeCount());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(4);
+        bool updateCompleted = true;
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 1u, updateCompleted));
+        EXPECT_FALSE(updateCompleted);
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0]));
+        EXPECT_EQ(1u, m_logicEngine.getLastUpdateReport().getDeferredNodeCount());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[1], m_scripts[2], m_scripts[3]));
+        EXPECT_EQ(4, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+    }
+
+    TEST_F(ALogicEngine_ParallelUpdate, CompletesInterruptedSerialUpdate)
+    {
+        linkScriptsToChain();
+        ASSERT_TRUE(m_logicEngine.update());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        bool updateCompleted = true;
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 2u, updateCompleted));
+        EXPECT_FALSE(updateCompleted);
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[0], m_scripts[1]));
+
+        m_logicEngine.setParallelUpdateWorkerCount(2u);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(getExecutedNodes(), ::testing::ElementsAre(m_scripts[2], m_scripts[3]));
+        EXPECT_EQ(5, *m_scripts[3]->getOutputs()->getChild("out")->get<int32_t>());
+
+        m_logicEngine.setParallelUpdateWorkerCount(0u);
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 1u, updateCompleted));
+        EXPECT_TRUE(updateCompleted);
+        EXPECT_TRUE(getExecutedNodes().empty());
+        EXPECT_EQ(0u, m_logicEngine.getLastUpdateReport().getDeferredNodeCount());
+    }
+
+    class ALogicEngine_OutputSnapshot : public ALogicEngine_UpdateWithBudget
+    {
+    protected:
+        ALogicEngine_OutputSnapshot()
+        {
+            linkScriptsToChain();
+        }
+
+        OutputSnapshot& m_snapshot = m_logicEngine.getOutputSnapshot();
+    };
+
+    TEST_F(ALogicEngine_OutputSnapshot, PublishesValuesOfSelectedPropertiesAfterUpdate)
+    {
+        m_scripts[0]->getInputs()->getChild("in1")->set(3);
+        ASSERT_TRUE(m_logicEngine.setOutputSnapshotProperties({ m_scripts[3]->getOutputs()->getChild("out"), m_scripts[0]->getInputs()->getChild("in1") }));
+        EXPECT_EQ(2u, m_snapshot.getValueCount());
+        EXPECT_EQ(0u, m_snapshot.getVersion());
+        EXPECT_EQ(0, m_snapshot.get<int32_t>(0u));
+        EXPECT_EQ(3, m_snapshot.get<int32_t>(1u));
+        EXPECT_FALSE(m_snapshot.acquireLatest());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        // values are not visible before acquired
+        EXPECT_EQ(0, m_snapshot.get<int32_t>(0u));
+        EXPECT_TRUE(m_snapshot.acquireLatest());
+        EXPECT_EQ(1u, m_snapshot.getVersion());
+        EXPECT_EQ(3, m_snapshot.get<int32_t>(0u));
+        EXPECT_FALSE(m_snapshot.acquireLatest());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(4);
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_snapshot.acquireLatest());
+        EXPECT_EQ(3u, m_snapshot.getVersion());
+        EXPECT_EQ(4, m_snapshot.get<int32_t>(0u));
+        EXPECT_EQ(4, m_snapshot.get<int32_t>(1u));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, ReturnsNothingForWrongTypeOrIndex)
+    {
+        ASSERT_TRUE(m_logicEngine.setOutputSnapshotProperties({ m_scripts[3]->getOutputs()->getChild("out") }));
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_snapshot.acquireLatest());
+
+        EXPECT_FALSE(m_snapshot.get<float>(0u));
+        EXPECT_FALSE(m_snapshot.get<int32_t>(1u));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, PublishesOnlyAfterInterruptedUpdateCompleted)
+    {
+        ASSERT_TRUE(m_logicEngine.setOutputSnapshotProperties({ m_scripts[3]->getOutputs()->getChild("out") }));
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+
+        bool updateCompleted = true;
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 2u, updateCompleted));
+        EXPECT_FALSE(m_snapshot.acquireLatest());
+        ASSERT_TRUE(m_logicEngine.update({ m_scripts[3]->getOutputs()->getChild("out") }));
+        EXPECT_FALSE(m_snapshot.acquireLatest());
+
+        ASSERT_TRUE(m_logicEngine.updateWithBudget(UnlimitedTime, 2u, updateCompleted));
+        EXPECT_TRUE(updateCompleted);
+        EXPECT_TRUE(m_snapshot.acquireLatest());
+        EXPECT_EQ(5, m_snapshot.get<int32_t>(0u));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, KeepsLastPublishedValueOfPropertyOfDestroyedNode)
+    {
+        ASSERT_TRUE(m_logicEngine.setOutputSnapshotProperties({ m_scripts[3]->getOutputs()->getChild("out"), m_scripts[2]->getOutputs()->getChild("out") }));
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        ASSERT_TRUE(m_logicEngine.destroy(*m_scripts[3]));
+        m_scripts[0]->getInputs()->getChild("in1")->set(6);
+        for (int i = 0; i < 3; ++i)
+            ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_TRUE(m_snapshot.acquireLatest());
+        EXPECT_EQ(5, m_snapshot.get<int32_t>(0u));
+        EXPECT_EQ(6, m_snapshot.get<int32_t>(1u));
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, PublishesEmptySnapshotWhenLoading)
+    {
+        WithTempDirectory tempDir;
+        ASSERT_TRUE(m_logicEngine.saveToFile("snapshot.rlogic", m_saveFileConfigNoValidation));
+
+        ASSERT_TRUE(m_logicEngine.setOutputSnapshotProperties({ m_scripts[3]->getOutputs()->getChild("out") }));
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+        ASSERT_TRUE(m_snapshot.acquireLatest());
+
+        ASSERT_TRUE(m_logicEngine.loadFromFile("snapshot.rlogic"));
+        // values acquired before loading stay readable until next snapshot is acquired
+        EXPECT_EQ(5, m_snapshot.get<int32_t>(0u));
+        EXPECT_TRUE(m_snapshot.acquireLatest());
+        EXPECT_EQ(2u, m_snapshot.getVersion());
+        EXPECT_EQ(0u, m_snapshot.getValueCount());
+        EXPECT_FALSE(m_snapshot.get<int32_t>(0u));
+
+        // nothing published until properties are selected again
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_FALSE(m_snapshot.acquireLatest());
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, CanBeReadWhileLoading)
+    {
+        WithTempDirectory tempDir;
+        ASSERT_TRUE(m_logicEngine.saveToFile("snapshot.rlogic", m_saveFileConfigNoValidation));
+        ASSERT_TRUE(m_logicEngine.setOutputSnapshotProperties({ m_scripts[3]->getOutputs()->getChild("out") }));
+        m_scripts[0]->getInputs()->getChild("in1")->set(7);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        std::atomic<bool> loaded{ false };
+        std::thread reader([this, &loaded]() {
+            // reads either the values published before loading or the empty snapshot published by loading
+            while (!loaded || m_snapshot.getValueCount() != 0u)
+            {
+                m_snapshot.acquireLatest();
+                if (m_snapshot.getValueCount() != 0u)
+                    EXPECT_EQ(7, m_snapshot.get<int32_t>(0u));
+            }
+        });
+
+        for (int i = 0; i < 5; ++i)
+            ASSERT_TRUE(m_logicEngine.loadFromFile("snapshot.rlogic"));
+        loaded = true;
+        reader.join();
+
+        EXPECT_EQ(0u, m_snapshot.getValueCount());
+    }
+
+    TEST_F(ALogicEngine_OutputSnapshot, FailsToSelectInvalidProperties)
+    {
+        ASSERT_TRUE(m_logicEngine.setOutputSnapshotProperties({ m_scripts[3]->getOutputs()->getChild("out") }));
+
+        EXPECT_FALSE(m_logicEngine.setOutputSnapshotProperties({ nullptr }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot publish a null property in output snapshot", m_logicEngine.getErrors()[0].message);
+
+        LogicEngine otherEngine;
+        const auto* otherScript = otherEngine.createLuaScript(m_scriptSource, {}, "otherScript");
+        EXPECT_FALSE(m_logicEngine.setOutputSnapshotProperties({ otherScript->getOutputs()->getChild("out") }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot publish property 'out' in output snapshot, LogicNode 'otherScript' is not an instance of this LogicEngine", m_logicEngine.getErrors()[0].message);
+
+        const auto* structScript = m_logicEngine.createLuaScript(R"(
+            function interface(IN,OUT)
+                OUT.s = { a = Type:Int32() }
+            end
+            function run(IN,OUT)
+            end
+        )", {}, "structScript");
+        EXPECT_FALSE(m_logicEngine.setOutputSnapshotProperties({ structScript->getOutputs()->getChild("s") }));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Cannot publish property 's' in output snapshot, only properties of primitive type can be published", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(structScript, m_logicEngine.getErrors()[0].object);
+
+        // previous selection is kept
+        EXPECT_EQ(1u, m_snapshot.getValueCount());
+    }
+
+    class ALogicEngine_ChangedProperties : public ALogicEngine_UpdateWithBudget
+    {
+    protected:
+        ALogicEngine_ChangedProperties()
+        {
+            linkScriptsToChain();
+        }
+
+        [[nodiscard]] const Property* in1(size_t scriptIndex) const
+        {
+            return m_scripts[scriptIndex]->getInputs()->getChild("in1");
+        }
+
+        [[nodiscard]] const Property* out(size_t scriptIndex) const
+        {
+            return m_scripts[scriptIndex]->getOutputs()->getChild("out");
+        }
+    };
+
+    TEST_F(ALogicEngine_ChangedProperties, StampsChangedValuesWithGenerationOfUpdate)
+    {
+        EXPECT_EQ(0u, m_logicEngine.getUpdateGeneration());
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1u, m_logicEngine.getUpdateGeneration());
+        // all values stay at their defaults
+        EXPECT_TRUE(m_logicEngine.collectChangedProperties(0u).empty());
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        // input value is consumed by next update
+        EXPECT_EQ(2u, in1(0)->getChangeGeneration());
+        EXPECT_EQ(0u, out(0)->getChangeGeneration());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(2u, m_logicEngine.getUpdateGeneration());
+        EXPECT_EQ(2u, out(3)->getChangeGeneration());
+        const std::vector<const Property*> expectedChanges{ in1(0), out(0), in1(1), out(1), in1(2), out(2), in1(3), out(3) };
+        EXPECT_EQ(expectedChanges, m_logicEngine.collectChangedProperties(1u));
+        EXPECT_TRUE(m_logicEngine.collectChangedProperties(2u).empty());
+
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(3u, m_logicEngine.getUpdateGeneration());
+        EXPECT_TRUE(m_logicEngine.collectChangedProperties(2u).empty());
+        EXPECT_EQ(2u, out(3)->getChangeGeneration());
+    }
+
+    TEST_F(ALogicEngine_ChangedProperties, SettingSameValueIsNotAChange)
+    {
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+        const uint64_t generation = m_logicEngine.getUpdateGeneration();
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(5);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_TRUE(m_logicEngine.collectChangedProperties(generation).empty());
+        EXPECT_EQ(generation, in1(0)->getChangeGeneration());
+    }
+
+    TEST_F(ALogicEngine_ChangedProperties, CollectsChangedPropertiesOfSingleNode)
+    {
+        ASSERT_TRUE(m_logicEngine.update());
+        const uint64_t generation = m_logicEngine.getUpdateGeneration();
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(7);
+        ASSERT_TRUE(m_logicEngine.update());
+
+        const std::vector<const Property*> expectedChanges{ in1(2), out(2) };
+        EXPECT_EQ(expectedChanges, m_scripts[2]->collectChangedProperties(generation));
+        EXPECT_TRUE(m_scripts[2]->collectChangedProperties(m_logicEngine.getUpdateGeneration()).empty());
+    }
+
+    TEST_F(ALogicEngine_ChangedProperties, StampsValuesChangedByUpdateOfRequiredOutputs)
+    {
+        ASSERT_TRUE(m_logicEngine.update());
+        const uint64_t generation = m_logicEngine.getUpdateGeneration();
+
+        m_scripts[0]->getInputs()->getChild("in1")->set(3);
+        ASSERT_TRUE(m_logicEngine.update({ out(1) }));
+        EXPECT_EQ(generation + 1u, m_logicEngine.getUpdateGeneration());
+
+        const std::vector<const Property*> expectedChanges{ in1(0), out(0), in1(1), out(1), in1(2) };
+        EXPECT_EQ(expectedChanges, m_logicEngine.collectChangedProperties(generation));
+    }
 }
@@ -0,0 +1,188 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LogicEngineTest_Base.h"
+#include "WithTempDirectory.h"
+
+#include "impl/LuaScriptImpl.h"
+
+namespace rlogic::internal
+{
+    class ALuaScript_Instances : public ALogicEngine
+    {
+    protected:
+        ALuaScript_Instances()
+            : ALogicEngine{ EFeatureLevel_02 }
+        {
+        }
+
+        static const LuaScriptCode* GetCode(const LuaScript& script)
+        {
+            return script.m_script.getCode().get();
+        }
+
+        const std::string_view m_scriptSrc = R"(
+            function init()
+                GLOBAL.runs = 0
+            end
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                IN.nested = { factor = Type:Float(), values = Type:Array(2, Type:Vec2i()) }
+                OUT.value = Type:Int32()
+                OUT.runs = Type:Int32()
+            end
+            function run(IN,OUT)
+                GLOBAL.runs = GLOBAL.runs + 1
+                OUT.value = IN.value * 2
+                OUT.runs = GLOBAL.runs
+            end
+        )";
+
+        WithTempDirectory m_tempDirectory;
+    };
+
+    TEST_F(ALuaScript_Instances, CreatesInstanceWithSameInterfaceAsPrototype)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSrc, {}, "prototype");
+        ASSERT_NE(nullptr, prototype);
+
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype, "instance");
+        ASSERT_NE(nullptr, instance);
+        EXPECT_TRUE(m_logicEngine.getErrors().empty());
+        EXPECT_EQ("instance", instance->getName());
+        EXPECT_NE(prototype->getId(), instance->getId());
+        EXPECT_EQ(GetCode(*prototype), GetCode(*instance));
+
+        EXPECT_EQ(prototype->getInputs()->m_impl->getHierarchicalTypeData(), instance->getInputs()->m_impl->getHierarchicalTypeData());
+        EXPECT_EQ(prototype->getOutputs()->m_impl->getHierarchicalTypeData(), instance->getOutputs()->m_impl->getHierarchicalTypeData());
+        EXPECT_EQ(EPropertyType::Vec2i, instance->getInputs()->getChild("nested")->getChild("values")->getChild(1u)->getType());
+    }
+
+    TEST_F(ALuaScript_Instances, InstanceHasOwnPropertyValuesAndGlobals)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSrc);
+        ASSERT_NE(nullptr, prototype);
+        ASSERT_TRUE(prototype->getInputs()->getChild("value")->set<int32_t>(3));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        // values are not copied from prototype
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance);
+        EXPECT_EQ(0, *instance->getInputs()->getChild("value")->get<int32_t>());
+
+        ASSERT_TRUE(prototype->getInputs()->getChild("value")->set<int32_t>(4));
+        ASSERT_TRUE(instance->getInputs()->getChild("value")->set<int32_t>(10));
+        ASSERT_TRUE(m_logicEngine.update());
+
+        EXPECT_EQ(8, *prototype->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(2, *prototype->getOutputs()->getChild("runs")->get<int32_t>());
+        EXPECT_EQ(20, *instance->getOutputs()->getChild("value")->get<int32_t>());
+        EXPECT_EQ(1, *instance->getOutputs()->getChild("runs")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Instances, CreatesInstanceOfScriptWithModules)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(R"(
+            local mymath = {}
+            function mymath.double(v)
+                return v * 2
+            end
+            return mymath
+        )", CreateDeps({}), "mymath");
+        ASSERT_NE(nullptr, module);
+
+        LuaConfig config = CreateDeps({ { "mymath", module } });
+        config.addStandardModuleDependency(EStandardModule::String);
+        LuaScript* prototype = m_logicEngine.createLuaScript(R"(
+            modules("mymath")
+            function interface(IN,OUT)
+                IN.value = Type:Int32()
+                OUT.result = Type:String()
+            end
+            function run(IN,OUT)
+                OUT.result = string.format("%d", mymath.double(IN.value))
+            end
+        )", config);
+        ASSERT_NE(nullptr, prototype);
+
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance);
+        ASSERT_TRUE(instance->getInputs()->getChild("value")->set<int32_t>(21));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ("42", *instance->getOutputs()->getChild("result")->get<std::string>());
+    }
+
+    TEST_F(ALuaScript_Instances, InstanceIsIndependentOfDestroyedPrototype)
+    {
+        LuaScript* prototype = m_logicEngine.createLuaScript(m_scriptSrc);
+        ASSERT_NE(nullptr, prototype);
+        LuaScript* instance = m_logicEngine.createLuaScriptInstance(*prototype);
+        ASSERT_NE(nullptr, instance);
+
+        ASSERT_TRUE(m_logicEngine.destroy(*prototype));
+        ASSERT_TRUE(instance->getInputs()->getChild("value")->set<int32_t>(5));
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(10, *instance->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Instances, FailsToCreateInstanceOfScriptFromOtherLogicEngine)
+    {
+        LogicEngine otherLogicEngine{ EFeatureLevel_02 };
+        LuaScript* prototype = otherLogicEngine.createLuaScript(m_scriptSrc, {}, "prototype");
+        ASSERT_NE(nullptr, prototype);
+
+        EXPECT_EQ(nullptr, m_logicEngine.createLuaScriptInstance(*prototype));
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ("Failed to create instance of LuaScript 'prototype'! It was created on a different instance of LogicEngine.", m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(prototype, m_logicEngine.getErrors()[0].object);
+    }
+
+    TEST_F(ALuaScript_Instances, CreatesInstanceFromSourceCodeInFeatureLevel01)
+    {
+        LogicEngine logicEngine{ EFeatureLevel_01 };
+        LuaScript* prototype = logicEngine.createLuaScript(m_scriptSrc);
+        ASSERT_NE(nullptr, prototype);
+
+        LuaScript* instance = logicEngine.createLuaScriptInstance(*prototype, "instance");
+        ASSERT_NE(nullptr, instance);
+        ASSERT_TRUE(instance->getInputs()->getChild("value")->set<int32_t>(7));
+        ASSERT_TRUE(logicEngine.update());
+        EXPECT_EQ(14, *instance->getOutputs()->getChild("value")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Instances, InstancesShareCodeAfterLoadingFromFile)
+    {
+        for (const auto luaSavingMode : { ELuaSavingMode::SourceCodeOnly, ELuaSavingMode::ByteCodeOnly, ELuaSavingMode::SourceAndByteCode })
+        {
+            {
+                LogicEngine logicEngine{ EFeatureLevel_02 };
+                LuaScript* prototype = logicEngine.createLuaScript(m_scriptSrc, {}, "prototype");
+                ASSERT_NE(nullptr, prototype);
+                LuaScript* instance = logicEngine.createLuaScriptInstance(*prototype, "instance");
+                ASSERT_NE(nullptr, instance);
+                ASSERT_TRUE(instance->getInputs()->getChild("value")->set<int32_t>(6));
+                // script with same source which is not an instance
+                ASSERT_NE(nullptr, logicEngine.createLuaScript(m_scriptSrc, {}, "copy"));
+
+                SaveFileConfig config = m_saveFileConfigNoValidation;
+                config.setLuaSavingMode(luaSavingMode);
+                ASSERT_TRUE(logicEngine.saveToFile("instances.rlogic", config));
+            }
+
+            ASSERT_TRUE(m_logicEngine.loadFromFile("instances.rlogic"));
+            const LuaScript* prototype = m_logicEngine.findByName<LuaScript>("prototype");
+            LuaScript* instance = m_logicEngine.findByName<LuaScript>("instance");
+            ASSERT_TRUE(prototype && instance);
+            EXPECT_EQ(GetCode(*prototype), GetCode(*instance));
+
+            EXPECT_EQ(6, *instance->getInputs()->getChild("value")->get<int32_t>());
+            ASSERT_TRUE(m_logicEngine.update());
+            EXPECT_EQ(12, *instance->getOutputs()->getChild("value")->get<int32_t>());
+        }
+    }
+}
@@ -0,0 +1,132 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "LuaScriptTest_Base.h"
+
+#include "ramses-logic/LuaScript.h"
+#include "ramses-logic/LuaModule.h"
+#include "ramses-logic/Property.h"
+#include "internals/SolState.h"
+#include "fmt/format.h"
+
+namespace rlogic
+{
+    class ALuaScript_Memory : public ALuaScript
+    {
+    protected:
+        void SetUp() override
+        {
+            if (!internal::SolState::HasMemoryAccounting())
+                GTEST_SKIP() << "Lua backend does not support memory accounting";
+        }
+
+        const std::string_view m_allocatingScriptSrc = R"(
+            function interface(IN,OUT)
+                IN.count = Type:Int32()
+                OUT.count = Type:Int32()
+            end
+            function run(IN,OUT)
+                local t = {}
+                for i = 1, IN.count do
+                    t[i] = { value = i }
+                end
+                OUT.count = #t
+            end
+        )";
+    };
+
+    TEST_F(ALuaScript_Memory, AccountsMemoryAllocatedWhenLoadingScript)
+    {
+        LuaScript* minimalScript = m_logicEngine.createLuaScript(m_minimalScript);
+        LuaScript* scriptWithData = m_logicEngine.createLuaScript(R"(
+            function init()
+                GLOBAL.data = {}
+                for i = 1, 10000 do
+                    GLOBAL.data[i] = i
+                end
+            end
+            function interface(IN,OUT)
+            end
+            function run(IN,OUT)
+            end
+        )");
+        ASSERT_TRUE(minimalScript && scriptWithData);
+
+        EXPECT_GT(minimalScript->getMemoryUsage(), 0u);
+        EXPECT_GT(scriptWithData->getMemoryUsage(), minimalScript->getMemoryUsage() + 10000u * sizeof(double));
+    }
+
+    TEST_F(ALuaScript_Memory, AccountsMemoryAllocatedInRunFunctionToScript)
+    {
+        LuaScript* script = m_logicEngine.createLuaScript(m_allocatingScriptSrc);
+        ASSERT_NE(nullptr, script);
+
+        // make sure garbage is not collected in between
+        m_logicEngine.enableAutomaticLuaGarbageCollection(false);
+        const size_t memoryBeforeRun = script->getMemoryUsage();
+        script->getInputs()->getChild("count")->set<int32_t>(1000);
+        ASSERT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(1000, *script->getOutputs()->getChild("count")->get<int32_t>());
+
+        EXPECT_GT(script->getMemoryUsage(), memoryBeforeRun + 1000u * sizeof(double));
+
+        // garbage created by run is freed and credited back to script
+        EXPECT_TRUE(m_logicEngine.collectLuaGarbage(std::chrono::seconds(10)));
+        EXPECT_LT(script->getMemoryUsage(), memoryBeforeRun + 1000u * sizeof(double));
+    }
+
+    TEST_F(ALuaScript_Memory, ReportsRuntimeErrorWhenScriptExceedsMemoryLimit)
+    {
+        LuaScript* script = m_logicEngine.createLuaScript(m_allocatingScriptSrc, {}, "greedyScript");
+        ASSERT_NE(nullptr, script);
+
+        const size_t limit = script->getMemoryUsage() + 64u * 1024u;
+        script->setMemoryLimit(limit);
+
+        script->getInputs()->getChild("count")->set<int32_t>(10);
+        EXPECT_TRUE(m_logicEngine.update());
+
+        script->getInputs()->getChild("count")->set<int32_t>(100000);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(fmt::format("Lua script exceeded its memory limit of {} bytes!", limit), m_logicEngine.getErrors()[0].message);
+        EXPECT_EQ(script, m_logicEngine.getErrors()[0].object);
+        EXPECT_LE(script->getMemoryUsage(), limit);
+
+        // removing limit lets script run again
+        script->setMemoryLimit(0u);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(100000, *script->getOutputs()->getChild("count")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Memory, MemoryLimitOfOneScriptDoesNotAffectOtherScripts)
+    {
+        LuaScript* limitedScript = m_logicEngine.createLuaScript(m_allocatingScriptSrc);
+        LuaScript* otherScript = m_logicEngine.createLuaScript(m_allocatingScriptSrc);
+        ASSERT_TRUE(limitedScript && otherScript);
+        limitedScript->setMemoryLimit(limitedScript->getMemoryUsage() + 64u * 1024u);
+
+        otherScript->getInputs()->getChild("count")->set<int32_t>(100000);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_EQ(100000, *otherScript->getOutputs()->getChild("count")->get<int32_t>());
+    }
+
+    TEST_F(ALuaScript_Memory, AccountsMemoryAllocatedWhenLoadingModuleToModule)
+    {
+        LuaModule* module = m_logicEngine.createLuaModule(R"(
+            local mymod = {}
+            mymod.data = {}
+            for i = 1, 10000 do
+                mymod.data[i] = i
+            end
+            return mymod
+        )");
+        ASSERT_NE(nullptr, module);
+        EXPECT_GT(module->getMemoryUsage(), 10000u * sizeof(double));
+    }
+}
@@ -13,7 +13,9 @@
 #include "impl/PropertyImpl.h"
 #include "impl/LuaModuleImpl.h"
 #include "internals/ErrorReporting.h"
+#include "internals/SolState.h"
 
+#include "fmt/format.h"
 #include "generated/LuaScriptGen.h"
 
 #include "SerializationTestUtils.h"
@@ -473,6 +475,42 @@ namespace rlogic::internal
         EXPECT_THAT(m_errorReporting.getErrors()[1].message, ::testing::HasSubstr("Fatal error during loading of LuaScript 'name' from serialized data"));
     }
 
+    TEST_P(ALuaScript_Serialization, ProducesErrorWhenByteCodeProducedByOtherLuaBackendAndNoSourceAvailable)
+    {
+        if (m_featureLevel < EFeatureLevel_02)
+            GTEST_SKIP();
+
+        {
+            // signature of bytecode produced by the Lua backend this build does not use
+            const std::string_view otherBackendSignature = (SolState::GetLuaBackendName() == "LuaJIT" ? std::string_view("\x1bLua\x51", 5u) : std::string_view("\x1bLJ\x02", 4u));
+            std::vector<uint8_t> otherBackendByteCode(otherBackendSignature.cbegin(), otherBackendSignature.cend());
+            otherBackendByteCode.resize(32u, 0u);
+
+            auto script = rlogic_serialization::CreateLuaScript(
+                m_flatBufferBuilder,
+                rlogic_serialization::CreateLogicObject(m_flatBufferBuilder,
+                    m_flatBufferBuilder.CreateString("name"),
+                    1u),
+                0,
+                m_flatBufferBuilder.CreateVector(std::vector<flatbuffers::Offset<rlogic_serialization::LuaModuleUsage>>{}),
+                m_flatBufferBuilder.CreateVector(std::vector<uint8_t>{}),
+                m_testUtils.serializeTestProperty(""),
+                m_testUtils.serializeTestProperty(""),
+                m_flatBufferBuilder.CreateVector(otherBackendByteCode)
+            );
+            m_flatBufferBuilder.Finish(script);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::LuaScript>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<LuaScriptImpl> deserialized = LuaScriptImpl::Deserialize(m_solState, serialized, m_errorReporting, m_deserializationMap, m_featureLevel);
+
+        EXPECT_FALSE(deserialized);
+        ASSERT_EQ(m_errorReporting.getErrors().size(), 2u);
+        EXPECT_THAT(m_errorReporting.getErrors()[0].message, ::testing::HasSubstr("Fatal error during loading of LuaScript 'name': failed loading pre-compiled byte code"));
+        EXPECT_THAT(m_errorReporting.getErrors()[0].message, ::testing::HasSubstr(fmt::format("but this build uses '{}'", SolState::GetLuaBackendName())));
+        EXPECT_EQ(m_errorReporting.getErrors()[0].type, EErrorType::BinaryVersionMismatch);
+    }
+
     TEST_P(ALuaScript_Serialization, WillTryToRecompileScriptFromSourceWhenByteCodeInvalid)
     {
         if (m_featureLevel < EFeatureLevel_02)
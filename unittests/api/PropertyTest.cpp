@@ -23,6 +23,8 @@
 #include "LogicNodeDummy.h"
 #include "LogTestUtils.h"
 
+#include <array>
+#include <limits>
 #include <memory>
 #include <fmt/format.h>
 
@@ -682,6 +684,27 @@ namespace rlogic::internal
         EXPECT_FALSE(c3);
     }
 
+    TEST_F(AProperty, ReturnsChildByNameOfWideStruct)
+    {
+        // wide enough to be indexed by hash
+        std::vector<TypeData> fields;
+        for (size_t i = 0u; i < 200u; ++i)
+            fields.emplace_back(fmt::format("field{}", i), EPropertyType::Int32);
+        Property root(CreateProperty(MakeStruct("wide", fields), EPropertySemantics::ScriptInput, true));
+
+        for (size_t i = 0u; i < 200u; ++i)
+        {
+            const std::string name = fmt::format("field{}", i);
+            ASSERT_TRUE(root.hasChild(name));
+            EXPECT_EQ(root.getChild(i), root.getChild(name));
+            EXPECT_EQ(i, *root.m_impl->findChildIndex(name));
+        }
+
+        EXPECT_FALSE(root.hasChild("field200"));
+        EXPECT_EQ(nullptr, root.getChild("field200"));
+        EXPECT_FALSE(root.m_impl->findChildIndex("field200"));
+    }
+
     class AProperty_SerializationLifecycle : public AProperty
     {
     protected:
@@ -736,6 +759,25 @@ namespace rlogic::internal
         EXPECT_EQ("child2", deserialized->getChild(2)->getName());
     }
 
+    TEST_F(AProperty_SerializationLifecycle, FindsChildrenOfWideStructByName)
+    {
+        {
+            std::vector<TypeData> fields;
+            for (size_t i = 0u; i < 50u; ++i)
+                fields.emplace_back(fmt::format("field{}", i), EPropertyType::Float);
+            PropertyImpl structProperty(MakeStruct("wide", fields), EPropertySemantics::ScriptInput);
+            (void)PropertyImpl::Serialize(structProperty, m_flatBufferBuilder, m_serializationMap);
+        }
+
+        const auto& serialized = *flatbuffers::GetRoot<rlogic_serialization::Property>(m_flatBufferBuilder.GetBufferPointer());
+        std::unique_ptr<PropertyImpl> deserialized = PropertyImpl::Deserialize(serialized, EPropertySemantics::ScriptInput, m_errorReporting, m_deserializationMap);
+
+        ASSERT_EQ(50u, deserialized->getChildCount());
+        for (size_t i = 0u; i < 50u; ++i)
+            EXPECT_EQ(deserialized->getChild(i), deserialized->getChild(fmt::format("field{}", i)));
+        EXPECT_FALSE(deserialized->hasChild("field50"));
+    }
+
     TEST_F(AProperty_SerializationLifecycle, MultiLevelNesting)
     {
         {
@@ -1156,4 +1198,127 @@ namespace rlogic::internal
         EXPECT_EQ(logMessage, fmt::format("Invalid value when setting property 'int64input', Lua cannot handle full range of 64-bit integer, trying to set '{}' which is out of this range!",
             -maxIntegerAsDouble - 1).c_str());
     }
+
+    TEST_F(AProperty, SetsAndGetsAllArrayElementsAtOnce)
+    {
+        Property floatArray{ CreateProperty(MakeArray("floats", 3, EPropertyType::Float), EPropertySemantics::ScriptInput, true) };
+        Property vec2iArray{ CreateProperty(MakeArray("vecs", 2, EPropertyType::Vec2i), EPropertySemantics::ScriptInput, true) };
+
+        const std::vector<float> floatValues{ 1.f, 2.f, 3.f };
+        const std::vector<vec2i> vecValues{ vec2i{ 1, 2 }, vec2i{ 3, 4 } };
+        EXPECT_TRUE(floatArray.setArray(floatValues.data(), floatValues.size()));
+        EXPECT_TRUE(vec2iArray.setArray(vecValues.data(), vecValues.size()));
+
+        EXPECT_EQ(2.f, *floatArray.getChild(1u)->get<float>());
+        EXPECT_EQ((vec2i{ 3, 4 }), *vec2iArray.getChild(1u)->get<vec2i>());
+
+        std::vector<float> readFloats(3u);
+        std::vector<vec2i> readVecs(2u);
+        EXPECT_TRUE(floatArray.getArray(readFloats.data(), readFloats.size()));
+        EXPECT_TRUE(vec2iArray.getArray(readVecs.data(), readVecs.size()));
+        EXPECT_EQ(floatValues, readFloats);
+        EXPECT_EQ(vecValues, readVecs);
+    }
+
+    TEST_F(AProperty, SetsAndGetsEmptyArrayWithoutValues)
+    {
+        Property emptyArray{ CreateProperty(MakeArray("empty", 0, EPropertyType::Float), EPropertySemantics::ScriptInput, true) };
+        m_dummyNode.setDirty(false);
+
+        EXPECT_TRUE(emptyArray.setArray<float>(nullptr, 0u));
+        EXPECT_TRUE(emptyArray.getArray<float>(nullptr, 0u));
+        EXPECT_FALSE(m_dummyNode.isDirty());
+
+        std::array<float, 1> floats{ 1.f };
+        EXPECT_FALSE(emptyArray.setArray(floats.data(), floats.size()));
+        EXPECT_FALSE(emptyArray.getArray(floats.data(), floats.size()));
+        EXPECT_EQ(1.f, floats[0]);
+    }
+
+    TEST_F(AProperty, SetArraySetsLogicNodeToDirtyOnlyIfAnyValueChanged)
+    {
+        Property intArray{ CreateProperty(MakeArray("ints", 3, EPropertyType::Int32), EPropertySemantics::ScriptInput, true) };
+        m_dummyNode.setDirty(false);
+
+        const std::array<int32_t, 3> zeros{ 0, 0, 0 };
+        EXPECT_TRUE(intArray.setArray(zeros.data(), zeros.size()));
+        EXPECT_FALSE(m_dummyNode.isDirty());
+
+        const std::array<int32_t, 3> values{ 0, 0, 5 };
+        EXPECT_TRUE(intArray.setArray(values.data(), values.size()));
+        EXPECT_TRUE(m_dummyNode.isDirty());
+        EXPECT_EQ(5, *intArray.getChild(2u)->get<int32_t>());
+    }
+
+    TEST_F(AProperty, FailsToSetArrayWithoutModifyingAnyElement)
+    {
+        Property int64Array{ CreateProperty(MakeArray("int64s", 2, EPropertyType::Int64), EPropertySemantics::ScriptInput, true) };
+        Property outputArray{ CreateProperty(MakeArray("outputs", 2, EPropertyType::Int64), EPropertySemantics::ScriptOutput, true) };
+        Property int64Value{ CreateProperty(MakeType("int64", EPropertyType::Int64), EPropertySemantics::ScriptInput, true) };
+        m_dummyNode.setDirty(false);
+
+        std::string logMessage;
+        ScopedLogContextLevel logCollector{ ELogMessageType::Error, [&](ELogMessageType /*type*/, std::string_view message)
+        {
+            logMessage = message;
+        }
+        };
+
+        const std::array<int64_t, 2> outOfRange{ 1, std::numeric_limits<int64_t>::max() };
+        EXPECT_FALSE(int64Array.setArray(outOfRange.data(), outOfRange.size()));
+        EXPECT_EQ(logMessage, fmt::format("Cannot set element #1 of array property 'int64s': Invalid value when setting property '', Lua cannot handle full range of 64-bit integer, trying to set '{}' which is out of this range!",
+            std::numeric_limits<int64_t>::max()));
+
+        const std::array<int32_t, 2> wrongType{ 1, 2 };
+        EXPECT_FALSE(int64Array.setArray(wrongType.data(), wrongType.size()));
+        EXPECT_EQ(logMessage, "Cannot set element #0 of array property 'int64s': Invalid type when setting property '', correct type is 'Int64'");
+
+        const std::array<int64_t, 3> tooMany{ 1, 2, 3 };
+        EXPECT_FALSE(int64Array.setArray(tooMany.data(), tooMany.size()));
+        EXPECT_EQ(logMessage, "Invalid number of values when setting array property 'int64s', expected 2 values but got 3");
+
+        EXPECT_FALSE(int64Array.setArray<int64_t>(nullptr, 2u));
+        EXPECT_EQ(logMessage, "Cannot set elements of array property 'int64s', values must not be null");
+
+        const std::array<int64_t, 2> values{ 1, 2 };
+        EXPECT_FALSE(outputArray.setArray(values.data(), values.size()));
+        EXPECT_EQ(logMessage, "Cannot set element #0 of array property 'outputs': Cannot set property '' which is an output.");
+
+        EXPECT_FALSE(int64Value.setArray(values.data(), 1u));
+        EXPECT_EQ(logMessage, "Property 'int64' is not an array, can't set its elements at once!");
+
+        EXPECT_EQ(0, *int64Array.getChild(0u)->get<int64_t>());
+        EXPECT_EQ(0, *int64Array.getChild(1u)->get<int64_t>());
+        EXPECT_FALSE(m_dummyNode.isDirty());
+    }
+
+    TEST_F(AProperty, FailsToGetArrayIfTypeOrCountDoesNotMatch)
+    {
+        Property floatArray{ CreateProperty(MakeArray("floats", 2, EPropertyType::Float), EPropertySemantics::ScriptInput, true) };
+        Property floatValue{ CreateProperty(MakeType("float", EPropertyType::Float), EPropertySemantics::ScriptInput, true) };
+
+        std::string logMessage;
+        ScopedLogContextLevel logCollector{ ELogMessageType::Error, [&](ELogMessageType /*type*/, std::string_view message)
+        {
+            logMessage = message;
+        }
+        };
+
+        std::array<int32_t, 2> ints{};
+        EXPECT_FALSE(floatArray.getArray(ints.data(), ints.size()));
+        EXPECT_EQ(logMessage, "Invalid type 'Int32' when accessing elements of property 'floats', property is not an array of this type");
+
+        std::array<float, 3> floats{};
+        EXPECT_FALSE(floatArray.getArray(floats.data(), floats.size()));
+        EXPECT_EQ(logMessage, "Invalid number of values when accessing array property 'floats', expected 2 values but got 3");
+
+        EXPECT_FALSE(floatArray.getArray<float>(nullptr, 2u));
+        EXPECT_EQ(logMessage, "Cannot access elements of array property 'floats', values must not be null");
+
+        EXPECT_FALSE(floatArray.getArray<float>(nullptr, 0u));
+        EXPECT_EQ(logMessage, "Invalid number of values when accessing array property 'floats', expected 2 values but got 0");
+
+        EXPECT_FALSE(floatValue.getArray(floats.data(), 1u));
+        EXPECT_EQ(logMessage, "Invalid type 'Float' when accessing elements of property 'float', property is not an array of this type");
+    }
 }
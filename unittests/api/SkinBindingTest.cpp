@@ -6,6 +6,8 @@
 //  file, You can obtain one at https://mozilla.org/MPL/2.0/.
 //  -------------------------------------------------------------------------
 
+#include <gmock/gmock.h>
+
 #include "LogicEngineTest_Base.h"
 #include "RamsesTestUtils.h"
 #include "SerializationTestUtils.h"
@@ -171,6 +173,27 @@ namespace rlogic::internal
             EXPECT_NEAR(expectedMat2[i], mat2[i], 1e-4f) << i;
     }
 
+    TEST_F(ASkinBinding, IsExecutedOnlyWhenJointBindingChangesTransformationIfTransformChangeTrackingEnabled)
+    {
+        m_logicEngine.enableUpdateReport(true);
+        m_logicEngine.enableTransformChangeTracking(true);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::Not(::testing::Contains(m_skin)));
+
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::Contains(m_skin));
+
+        EXPECT_TRUE(m_joints[1]->m_nodeBinding.getInputs()->getChild("translation")->set<vec3f>({ -1.f, -2.f, -3.f }));
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_THAT(m_logicEngine.getLastUpdateReport().getNodesSkippedExecution(), ::testing::Not(::testing::Contains(m_skin)));
+
+        std::array<float, 32u> uniformData{};
+        m_appearance->getInputValueMatrix44f(m_uniform, 2u, uniformData.data());
+        EXPECT_NEAR(-1.f, uniformData[28], 1e-4f);
+        EXPECT_NEAR(-2.f, uniformData[29], 1e-4f);
+        EXPECT_NEAR(-3.f, uniformData[30], 1e-4f);
+    }
+
     TEST_F(ASkinBinding, CalculatesSameValuesAfterLoadingFromFile)
     {
         WithTempDirectory tmpDir;
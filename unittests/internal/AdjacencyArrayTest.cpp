@@ -0,0 +1,98 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/AdjacencyArray.h"
+
+namespace rlogic::internal
+{
+    class AnAdjacencyArray : public ::testing::Test
+    {
+    protected:
+        std::vector<int> getList(size_t list) const
+        {
+            return { m_array.begin(list), m_array.end(list) };
+        }
+
+        AdjacencyArray<int> m_array;
+    };
+
+    TEST_F(AnAdjacencyArray, HasEmptyListsAfterResize)
+    {
+        m_array.resize(3u);
+        for (size_t list = 0u; list < 3u; ++list)
+        {
+            EXPECT_EQ(0u, m_array.size(list));
+            EXPECT_EQ(m_array.begin(list), m_array.end(list));
+        }
+    }
+
+    TEST_F(AnAdjacencyArray, KeepsElementsOfEachListInInsertionOrder)
+    {
+        m_array.resize(2u);
+        for (int i = 0; i < 20; ++i)
+        {
+            m_array.push(0u, i);
+            m_array.push(1u, -i);
+        }
+
+        EXPECT_EQ(20u, m_array.size(0u));
+        EXPECT_EQ(20u, m_array.size(1u));
+        for (int i = 0; i < 20; ++i)
+        {
+            EXPECT_EQ(i, getList(0u)[static_cast<size_t>(i)]);
+            EXPECT_EQ(-i, getList(1u)[static_cast<size_t>(i)]);
+        }
+    }
+
+    TEST_F(AnAdjacencyArray, ErasesElementKeepingOrderOfOthers)
+    {
+        m_array.resize(1u);
+        for (int i = 0; i < 5; ++i)
+            m_array.push(0u, i);
+
+        m_array.erase(0u, m_array.begin(0u) + 1);
+        EXPECT_THAT(getList(0u), ::testing::ElementsAre(0, 2, 3, 4));
+        m_array.erase(0u, m_array.end(0u) - 1);
+        EXPECT_THAT(getList(0u), ::testing::ElementsAre(0, 2, 3));
+    }
+
+    TEST_F(AnAdjacencyArray, ClearedListCanBeFilledAgain)
+    {
+        m_array.resize(2u);
+        m_array.push(0u, 1);
+        m_array.push(1u, 2);
+        m_array.clear(0u);
+        EXPECT_THAT(getList(0u), ::testing::IsEmpty());
+
+        m_array.push(0u, 3);
+        EXPECT_THAT(getList(0u), ::testing::ElementsAre(3));
+        EXPECT_THAT(getList(1u), ::testing::ElementsAre(2));
+    }
+
+    TEST_F(AnAdjacencyArray, KeepsContentOfAllListsWhenGrowingInterleaved)
+    {
+        // each list is relocated multiple times
+        constexpr size_t listCount = 50u;
+        m_array.resize(listCount);
+        for (int i = 0; i < 100; ++i)
+        {
+            for (size_t list = 0u; list < listCount; ++list)
+                m_array.push(list, static_cast<int>(list) * 1000 + i);
+        }
+
+        for (size_t list = 0u; list < listCount; ++list)
+        {
+            const std::vector<int> elements = getList(list);
+            ASSERT_EQ(100u, elements.size());
+            for (int i = 0; i < 100; ++i)
+                EXPECT_EQ(static_cast<int>(list) * 1000 + i, elements[static_cast<size_t>(i)]);
+        }
+    }
+}
@@ -265,6 +265,24 @@ namespace rlogic::internal
         EXPECT_TRUE(m_apiObjects.getApiObjectContainer<LogicObject>().empty());
     }
 
+    TEST_P(AnApiObjects, AllocatesPropertiesFromItsOwnPool)
+    {
+        ApiObjects otherInstance{ GetParam() };
+        RamsesNodeBinding* ramsesNodeBinding = m_apiObjects.createRamsesNodeBinding(*m_node, ERotationType::Euler_XYZ, "NodeBinding");
+        ASSERT_NE(nullptr, ramsesNodeBinding);
+        EXPECT_GT(m_apiObjects.getPropertyPool().getUsedBlockCount(), ramsesNodeBinding->getInputs()->getChildCount());
+        EXPECT_EQ(0u, otherInstance.getPropertyPool().getUsedBlockCount());
+
+        // properties created outside of ApiObjects are not allocated from any pool
+        const size_t usedBlocks = m_apiObjects.getPropertyPool().getUsedBlockCount();
+        auto property = std::make_unique<PropertyImpl>(MakeType("", EPropertyType::Int32), EPropertySemantics::ScriptInput);
+        EXPECT_EQ(usedBlocks, m_apiObjects.getPropertyPool().getUsedBlockCount());
+
+        ASSERT_TRUE(m_apiObjects.destroy(*ramsesNodeBinding, m_errorReporting));
+        EXPECT_EQ(0u, m_apiObjects.getPropertyPool().getUsedBlockCount());
+        EXPECT_GT(m_apiObjects.getPropertyPool().getChunkCount(), 0u);
+    }
+
     TEST_P(AnApiObjects, ProducesErrorsWhenDestroyingRamsesNodeBindingFromAnotherClassInstance)
     {
         ApiObjects otherInstance{ GetParam() };
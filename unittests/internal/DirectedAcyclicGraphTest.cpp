@@ -517,6 +517,107 @@ namespace rlogic::internal
         EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
     }
 
+    TEST_F(ADirectedAcyclicGraph, AssignsDenseIndicesToNodesAndReusesIndicesOfRemovedNodes)
+    {
+        addTestNodesToGraph(3);
+        EXPECT_EQ(0u, N1.getGraphIndex());
+        EXPECT_EQ(1u, N2.getGraphIndex());
+        EXPECT_EQ(2u, N3.getGraphIndex());
+
+        m_graph.removeNode(N2);
+        EXPECT_EQ(LogicNodeImpl::InvalidGraphIndex, N2.getGraphIndex());
+        EXPECT_FALSE(m_graph.containsNode(N2));
+
+        m_graph.addNode(N4);
+        EXPECT_EQ(1u, N4.getGraphIndex());
+
+        // reused index has no edges of the removed node
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N4, N1);
+        EXPECT_EQ(1u, m_graph.getInDegree(N4));
+        EXPECT_EQ(1u, m_graph.getOutDegree(N4));
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N3, &N4, &N1));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, KeepsOrderWhenNodesAreRemovedAndEdgesAddedBeforeSorting)
+    {
+        addTestNodesToGraph(6);
+
+        // N1 -> N2 -> N3, N1 -> N3
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N1, N3);
+        m_graph.removeNode(N4);
+        m_graph.removeNode(N2);
+
+        // ranks of removed nodes are not occupied anymore, new edges contradicting the order are still sorted correctly
+        m_graph.addEdge(N6, N1);
+        m_graph.addEdge(N5, N6);
+        updateOrdering();
+        EXPECT_THAT(getSortedTestNodes(), ::testing::UnorderedElementsAre(&N1, &N3, &N5, &N6));
+        EXPECT_LT(getRank(N5), getRank(N6));
+        EXPECT_LT(getRank(N6), getRank(N1));
+        EXPECT_LT(getRank(N1), getRank(N3));
+
+        m_graph.removeNode(N6);
+        m_graph.addNode(N2);
+        m_graph.addEdge(N3, N2);
+        m_graph.addEdge(N2, N5);
+        updateOrdering();
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N3, &N2, &N5));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, DetectsCycleNotReachableFromAnyRootNode)
+    {
+        addTestNodesToGraph(4);
+
+        // N1 -> N4    N2 <-> N3
+        m_graph.addEdge(N1, N4);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N2);
+
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, FindsShortestPathBetweenNodes)
+    {
+        addTestNodesToGraph(6);
+
+        /*
+         *  N1 -> N2 -> N3 -> N4
+         *   \     \          /
+         *    \     ----------
+         *     ---> N5            N6
+         */
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N2, N4);
+        m_graph.addEdge(N1, N5);
+
+        EXPECT_THAT(m_graph.findPath(N1, N4), ::testing::ElementsAre(&N1, &N2, &N4));
+        EXPECT_THAT(m_graph.findPath(N3, N4), ::testing::ElementsAre(&N3, &N4));
+        EXPECT_THAT(m_graph.findPath(N2, N2), ::testing::ElementsAre(&N2));
+        EXPECT_TRUE(m_graph.findPath(N4, N1).empty());
+        EXPECT_TRUE(m_graph.findPath(N5, N4).empty());
+        EXPECT_TRUE(m_graph.findPath(N1, N6).empty());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, FindsPathAlsoIfGraphHasCycle)
+    {
+        addTestNodesToGraph(4);
+
+        // N1 -> N2 -> N3 -> N1, N3 -> N4
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N1);
+        m_graph.addEdge(N3, N4);
+
+        EXPECT_THAT(m_graph.findPath(N2, N1), ::testing::ElementsAre(&N2, &N3, &N1));
+        EXPECT_THAT(m_graph.findPath(N1, N4), ::testing::ElementsAre(&N1, &N2, &N3, &N4));
+        EXPECT_TRUE(m_graph.findPath(N4, N1).empty());
+    }
+
     TEST_F(ADirectedAcyclicGraph, RemovesMultiLinksBetweenTwoNodes_OneByOne)
     {
         addTestNodesToGraph(2);
@@ -575,4 +676,171 @@ namespace rlogic::internal
 
         EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N3, &N2, &N1));
     }
+
+    TEST_F(ADirectedAcyclicGraph, ReordersOnlyNodesBetweenSourceAndTargetOfEdgeContradictingCurrentOrder)
+    {
+        addTestNodesToGraph(5);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N2, &N3, &N4, &N5));
+
+        m_graph.addEdge(N4, N2);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N4, &N3, &N2, &N5));
+
+        /*
+         *  N5 -> N1 -> N4 -> N2    N3 (keeps its rank)
+         */
+        m_graph.addEdge(N1, N4);
+        m_graph.addEdge(N5, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N5, &N1, &N3, &N4, &N2));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, DoesNotChangeOrderRevisionWhenEdgeAgreesWithCurrentOrder)
+    {
+        addTestNodesToGraph(3);
+        m_graph.addEdge(N1, N2);
+        const auto revision = m_graph.getTopologicalOrderRevision();
+
+        m_graph.removeEdge(N1, N2);
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N2, N3);
+        m_graph.removeEdge(N2, N3);
+        EXPECT_EQ(revision, m_graph.getTopologicalOrderRevision());
+
+        m_graph.addEdge(N3, N1);
+        m_graph.removeEdge(N2, N3);
+        EXPECT_NE(revision, m_graph.getTopologicalOrderRevision());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ChangesStructureRevisionWhenEdgeIsAddedOrRemovedEvenIfOrderIsKept)
+    {
+        addTestNodesToGraph(3);
+        auto revision = m_graph.getStructureRevision();
+
+        m_graph.addEdge(N1, N2);
+        EXPECT_NE(revision, m_graph.getStructureRevision());
+
+        // only multiplicity changes
+        revision = m_graph.getStructureRevision();
+        m_graph.addEdge(N1, N2);
+        m_graph.removeEdge(N1, N2);
+        EXPECT_EQ(revision, m_graph.getStructureRevision());
+
+        m_graph.removeEdge(N1, N2);
+        EXPECT_NE(revision, m_graph.getStructureRevision());
+
+        revision = m_graph.getStructureRevision();
+        m_graph.removeNode(N3);
+        EXPECT_NE(revision, m_graph.getStructureRevision());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ChangesOrderRevisionWhenNodesAreAddedOrRemoved)
+    {
+        auto revision = m_graph.getTopologicalOrderRevision();
+        addTestNodesToGraph(2);
+        EXPECT_NE(revision, m_graph.getTopologicalOrderRevision());
+
+        revision = m_graph.getTopologicalOrderRevision();
+        m_graph.removeNode(N1);
+        EXPECT_NE(revision, m_graph.getTopologicalOrderRevision());
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N2));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, RecoversOrderAfterCycleIsRemoved)
+    {
+        addTestNodesToGraph(3);
+
+        // N1 -> N2 -> N3 -> N1
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N1);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+
+        const auto revision = m_graph.getTopologicalOrderRevision();
+        m_graph.removeEdge(N1, N2);
+        EXPECT_NE(revision, m_graph.getTopologicalOrderRevision());
+
+        // N2 -> N3 -> N1
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N2, &N3, &N1));
+
+        // order is maintained incrementally again
+        m_graph.addEdge(N1, N2);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+    }
+
+    TEST_F(ADirectedAcyclicGraph, AssignsTopologicalLevelsToSortedNodes)
+    {
+        addTestNodesToGraph(6);
+
+        /*
+         *  N1 -> N2 -> N4
+         *   \          /
+         *    ----> N3 -    N5    N6
+         */
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N1, N3);
+        m_graph.addEdge(N2, N4);
+        m_graph.addEdge(N3, N4);
+        m_graph.addEdge(N1, N4);
+
+        updateOrdering();
+        const std::vector<size_t> levels = m_graph.getTopologicalLevels(getSortedTestNodes());
+        ASSERT_EQ(6u, levels.size());
+        EXPECT_EQ(0u, levels[getRank(N1)]);
+        EXPECT_EQ(0u, levels[getRank(N5)]);
+        EXPECT_EQ(0u, levels[getRank(N6)]);
+        EXPECT_EQ(1u, levels[getRank(N2)]);
+        EXPECT_EQ(1u, levels[getRank(N3)]);
+        EXPECT_EQ(2u, levels[getRank(N4)]);
+    }
+
+    TEST_F(ADirectedAcyclicGraph, TopologicalLevelOfNodeIsDeterminedByLongestPathToIt)
+    {
+        addTestNodesToGraph(4);
+
+        /*
+         *  N1 -> N2 -> N3 -> N4
+         *   \                /
+         *    ---------------
+         */
+        m_graph.addEdge(N1, N4);
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N4);
+
+        updateOrdering();
+        const std::vector<size_t> levels = m_graph.getTopologicalLevels(getSortedTestNodes());
+        ASSERT_EQ(4u, levels.size());
+        EXPECT_EQ(0u, levels[getRank(N1)]);
+        EXPECT_EQ(1u, levels[getRank(N2)]);
+        EXPECT_EQ(2u, levels[getRank(N3)]);
+        EXPECT_EQ(3u, levels[getRank(N4)]);
+    }
+
+    TEST_F(ADirectedAcyclicGraph, CollectsRanksOfNodesUpstreamOfGivenNodes)
+    {
+        addTestNodesToGraph(6);
+
+        /*
+         *  N1 -> N2 -> N4
+         *            *    --> N3    N5 -> N6
+         */
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N1, N3);
+        m_graph.addEdge(N2, N4);
+        m_graph.addEdge(N5, N6);
+
+        const NodeVector sortedNodes = getSortedTestNodes();
+        const auto nodesWithRanks = [&sortedNodes](const std::vector<size_t>& ranks) {
+            NodeVector nodes;
+            for (size_t rank : ranks)
+                nodes.push_back(sortedNodes[rank]);
+            return nodes;
+        };
+
+        EXPECT_THAT(nodesWithRanks(m_graph.getUpstreamNodeRanks({ &N4 })), ::testing::ElementsAre(&N1, &N2, &N4));
+        EXPECT_THAT(nodesWithRanks(m_graph.getUpstreamNodeRanks({ &N3 })), ::testing::ElementsAre(&N1, &N3));
+        EXPECT_THAT(nodesWithRanks(m_graph.getUpstreamNodeRanks({ &N1 })), ::testing::ElementsAre(&N1));
+        EXPECT_THAT(nodesWithRanks(m_graph.getUpstreamNodeRanks({ &N6, &N3, &N6 })), ::testing::ElementsAre(&N1, &N3, &N5, &N6));
+        EXPECT_THAT(m_graph.getUpstreamNodeRanks({}), ::testing::IsEmpty());
+    }
 }
@@ -0,0 +1,179 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/DirtyNodeWorklist.h"
+
+#include "LogicNodeDummy.h"
+
+#include <algorithm>
+
+namespace rlogic::internal
+{
+    class ADirtyNodeWorklist : public ::testing::Test
+    {
+    protected:
+        ADirtyNodeWorklist()
+        {
+            // enough nodes to span multiple words of the bitset
+            for (size_t i = 0u; i < 150u; ++i)
+            {
+                m_nodes.push_back(std::make_unique<LogicNodeDummyImpl>("node"));
+                m_nodes.back()->setDirty(false);
+                m_sortedNodes.push_back(m_nodes.back().get());
+            }
+            m_worklist.reset(m_sortedNodes);
+        }
+
+        std::vector<size_t> popAllMarked()
+        {
+            std::vector<size_t> ranks;
+            for (size_t rank = m_worklist.popNextMarked(0u); rank != DirtyNodeWorklist::InvalidRank; rank = m_worklist.popNextMarked(rank + 1u))
+                ranks.push_back(rank);
+            return ranks;
+        }
+
+        std::vector<std::unique_ptr<LogicNodeDummyImpl>> m_nodes;
+        NodeVector m_sortedNodes;
+        DirtyNodeWorklist m_worklist;
+    };
+
+    TEST_F(ADirtyNodeWorklist, HasNothingMarkedIfNoNodeIsDirty)
+    {
+        EXPECT_EQ(DirtyNodeWorklist::InvalidRank, m_worklist.popNextMarked(0u));
+    }
+
+    TEST_F(ADirtyNodeWorklist, MarksNodesWhichAreDirtyWhenReset)
+    {
+        m_nodes[3]->setDirty(true);
+        m_nodes[100]->setDirty(true);
+
+        DirtyNodeWorklist otherWorklist;
+        otherWorklist.reset(m_sortedNodes);
+        EXPECT_TRUE(otherWorklist.isMarked(3u));
+        EXPECT_TRUE(otherWorklist.isMarked(100u));
+        EXPECT_FALSE(otherWorklist.isMarked(4u));
+    }
+
+    TEST_F(ADirtyNodeWorklist, NodeSetDirtyMarksItselfWithItsRank)
+    {
+        m_nodes[140]->setDirty(true);
+        m_nodes[0]->setDirty(true);
+        m_nodes[63]->setDirty(true);
+        m_nodes[64]->setDirty(true);
+
+        EXPECT_THAT(popAllMarked(), ::testing::ElementsAre(0u, 63u, 64u, 140u));
+        EXPECT_THAT(popAllMarked(), ::testing::IsEmpty());
+    }
+
+    TEST_F(ADirtyNodeWorklist, SettingNodeNotDirtyUnmarksIt)
+    {
+        m_nodes[5]->setDirty(true);
+        m_nodes[6]->setDirty(true);
+        m_nodes[5]->setDirty(false);
+
+        EXPECT_FALSE(m_worklist.isMarked(5u));
+        EXPECT_THAT(popAllMarked(), ::testing::ElementsAre(6u));
+    }
+
+    TEST_F(ADirtyNodeWorklist, PopsOnlyMarksStartingAtGivenRank)
+    {
+        m_nodes[10]->setDirty(true);
+        m_nodes[20]->setDirty(true);
+        m_nodes[70]->setDirty(true);
+
+        EXPECT_EQ(70u, m_worklist.popNextMarked(21u));
+        EXPECT_EQ(20u, m_worklist.popNextMarked(20u));
+        EXPECT_EQ(DirtyNodeWorklist::InvalidRank, m_worklist.popNextMarked(11u));
+        EXPECT_TRUE(m_worklist.isMarked(10u));
+    }
+
+    TEST_F(ADirtyNodeWorklist, FindsMarksAddedAheadWhileIterating)
+    {
+        m_nodes[1]->setDirty(true);
+
+        std::vector<size_t> visited;
+        for (size_t rank = m_worklist.popNextMarked(0u); rank != DirtyNodeWorklist::InvalidRank; rank = m_worklist.popNextMarked(rank + 1u))
+        {
+            visited.push_back(rank);
+            // simulate link activation to a node with higher rank, and to one with lower rank (weak link)
+            if (rank == 1u)
+            {
+                m_nodes[99]->setDirty(true);
+                m_nodes[0]->setDirty(true);
+            }
+        }
+
+        EXPECT_THAT(visited, ::testing::ElementsAre(1u, 99u));
+        // node with lower rank stays marked for next iteration
+        EXPECT_THAT(popAllMarked(), ::testing::ElementsAre(0u));
+    }
+
+    TEST_F(ADirtyNodeWorklist, FindsMarksWithoutUnmarkingThem)
+    {
+        m_nodes[10]->setDirty(true);
+        m_nodes[70]->setDirty(true);
+
+        EXPECT_EQ(10u, m_worklist.findNextMarked(0u));
+        EXPECT_EQ(70u, m_worklist.findNextMarked(11u));
+        EXPECT_EQ(DirtyNodeWorklist::InvalidRank, m_worklist.findNextMarked(71u));
+        EXPECT_THAT(popAllMarked(), ::testing::ElementsAre(10u, 70u));
+    }
+
+    TEST_F(ADirtyNodeWorklist, LogsOnlyNewMarksWhileLogIsSet)
+    {
+        m_nodes[1]->setDirty(true);
+
+        std::vector<size_t> newMarks;
+        m_worklist.setNewMarksLog(&newMarks);
+        m_nodes[1]->setDirty(true);
+        m_nodes[80]->setDirty(true);
+        m_nodes[2]->setDirty(true);
+        m_nodes[80]->setDirty(true);
+        m_worklist.setNewMarksLog(nullptr);
+        m_nodes[3]->setDirty(true);
+
+        EXPECT_THAT(newMarks, ::testing::ElementsAre(80u, 2u));
+        EXPECT_THAT(popAllMarked(), ::testing::ElementsAre(1u, 2u, 3u, 80u));
+    }
+
+    TEST_F(ADirtyNodeWorklist, CountsMarksStartingAtGivenRank)
+    {
+        EXPECT_EQ(0u, m_worklist.countMarked(0u));
+
+        m_nodes[10]->setDirty(true);
+        m_nodes[63]->setDirty(true);
+        m_nodes[64]->setDirty(true);
+        m_nodes[149]->setDirty(true);
+
+        EXPECT_EQ(4u, m_worklist.countMarked(0u));
+        EXPECT_EQ(3u, m_worklist.countMarked(11u));
+        EXPECT_EQ(2u, m_worklist.countMarked(64u));
+        EXPECT_EQ(1u, m_worklist.countMarked(149u));
+        EXPECT_EQ(0u, m_worklist.countMarked(150u));
+        EXPECT_EQ(0u, m_worklist.countMarked(DirtyNodeWorklist::InvalidRank));
+    }
+
+    TEST_F(ADirtyNodeWorklist, IgnoresMarksOutOfRange)
+    {
+        m_worklist.mark(150u);
+        m_worklist.mark(DirtyNodeWorklist::InvalidRank - 1u);
+        EXPECT_THAT(popAllMarked(), ::testing::IsEmpty());
+        EXPECT_EQ(DirtyNodeWorklist::InvalidRank, m_worklist.popNextMarked(150u));
+    }
+
+    TEST_F(ADirtyNodeWorklist, ReassignsRanksOnReset)
+    {
+        std::reverse(m_sortedNodes.begin(), m_sortedNodes.end());
+        m_worklist.reset(m_sortedNodes);
+
+        m_nodes[0]->setDirty(true);
+        EXPECT_THAT(popAllMarked(), ::testing::ElementsAre(149u));
+    }
+}
@@ -0,0 +1,79 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/FixedSizePool.h"
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+#include <algorithm>
+
+namespace rlogic::internal
+{
+    class AFixedSizePool : public ::testing::Test
+    {
+    protected:
+        FixedSizePool m_pool{ 24u, 4u };
+    };
+
+    TEST_F(AFixedSizePool, AllocatesDistinctAlignedBlocks)
+    {
+        std::set<void*> blocks;
+        for (size_t i = 0u; i < 10u; ++i)
+        {
+            void* block = m_pool.allocate();
+            EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(block) % alignof(std::max_align_t));
+            // whole block is usable
+            std::memset(block, 0xff, 24u);
+            EXPECT_TRUE(blocks.insert(block).second);
+        }
+
+        EXPECT_EQ(10u, m_pool.getUsedBlockCount());
+        EXPECT_EQ(3u, m_pool.getChunkCount());
+
+        for (void* block : blocks)
+            m_pool.deallocate(block);
+    }
+
+    TEST_F(AFixedSizePool, ReusesFreedBlocks)
+    {
+        void* block1 = m_pool.allocate();
+        void* block2 = m_pool.allocate();
+        m_pool.deallocate(block1);
+
+        EXPECT_EQ(block1, m_pool.allocate());
+        EXPECT_EQ(1u, m_pool.getChunkCount());
+
+        m_pool.deallocate(block1);
+        m_pool.deallocate(block2);
+    }
+
+    TEST_F(AFixedSizePool, KeepsChunksWhenNoBlockIsUsed)
+    {
+        std::vector<void*> blocks;
+        for (size_t i = 0u; i < 9u; ++i)
+            blocks.push_back(m_pool.allocate());
+        EXPECT_EQ(3u, m_pool.getChunkCount());
+
+        for (void* block : blocks)
+            m_pool.deallocate(block);
+        EXPECT_EQ(0u, m_pool.getUsedBlockCount());
+        EXPECT_EQ(3u, m_pool.getChunkCount());
+
+        // same blocks are used again without allocating new chunks
+        for (size_t i = 0u; i < 9u; ++i)
+            EXPECT_NE(blocks.end(), std::find(blocks.begin(), blocks.end(), m_pool.allocate()));
+        EXPECT_EQ(9u, m_pool.getUsedBlockCount());
+        EXPECT_EQ(3u, m_pool.getChunkCount());
+
+        for (void* block : blocks)
+            m_pool.deallocate(block);
+    }
+}
@@ -293,6 +293,27 @@ namespace rlogic::internal
         expectLink(outputB, { { &inputA, true } });
     }
 
+    TEST_F(ALogicNodeDependencies, RefusesLinkWhichWouldCreateCycle)
+    {
+        m_dependencies.addNode(m_nodeA);
+        m_dependencies.addNode(m_nodeB);
+
+        PropertyImpl& inputA = *m_nodeA.getInputs()->getChild("input1")->m_impl;
+        PropertyImpl& outputA = *m_nodeA.getOutputs()->getChild("output1")->m_impl;
+        PropertyImpl& inputB = *m_nodeB.getInputs()->getChild("input2")->m_impl;
+        PropertyImpl& outputB = *m_nodeB.getOutputs()->getChild("output2")->m_impl;
+
+        EXPECT_TRUE(m_dependencies.link(outputA, inputB, false, m_errorReporting));
+        EXPECT_FALSE(m_dependencies.link(outputB, inputA, false, m_errorReporting));
+        ASSERT_EQ(1u, m_errorReporting.getErrors().size());
+        EXPECT_EQ("Failed to link property 'output2' of LogicNode 'B' to property 'input1' of LogicNode 'A', the link would create a cycle: "
+            "'A.output1' -> 'B.input2', 'B.output2' -> 'A.input1'. Use a weak link to break the cycle", m_errorReporting.getErrors()[0].message);
+
+        expectNoLinks(inputA);
+        expectNoLinks(outputB);
+        expectSortedNodeOrder({ &m_nodeA, &m_nodeB });
+    }
+
     class ALogicNodeDependencies_NestedLinks : public ALogicNodeDependencies
     {
     protected:
@@ -0,0 +1,201 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/LuaAllocator.h"
+
+#include <cstdint>
+#include <cstring>
+
+namespace rlogic::internal
+{
+    class ALuaAllocator : public ::testing::Test
+    {
+    protected:
+        void* allocate(size_t size)
+        {
+            return LuaAllocator::Allocate(&m_allocator, nullptr, 0u, size);
+        }
+
+        void* reallocate(void* ptr, size_t oldSize, size_t newSize)
+        {
+            return LuaAllocator::Allocate(&m_allocator, ptr, oldSize, newSize);
+        }
+
+        void deallocate(void* ptr, size_t size)
+        {
+            EXPECT_EQ(nullptr, LuaAllocator::Allocate(&m_allocator, ptr, size, 0u));
+        }
+
+        LuaAllocator m_allocator;
+    };
+
+    TEST_F(ALuaAllocator, AllocatesAlignedMemoryOfSmallAndBigSizes)
+    {
+        for (size_t size : { 1u, 7u, 16u, 100u, 248u, 249u, 1000u, 100000u })
+        {
+            void* ptr = allocate(size);
+            ASSERT_NE(nullptr, ptr);
+            EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(ptr) % alignof(double));
+            std::memset(ptr, 0xff, size);
+            EXPECT_EQ(size, m_allocator.getAllocatedBytes());
+            deallocate(ptr, size);
+            EXPECT_EQ(0u, m_allocator.getAllocatedBytes());
+        }
+    }
+
+    TEST_F(ALuaAllocator, ReusesFreedSmallBlocks)
+    {
+        void* ptr1 = allocate(24u);
+        void* ptr2 = allocate(24u);
+        deallocate(ptr1, 24u);
+        EXPECT_EQ(ptr1, allocate(20u));
+
+        deallocate(ptr1, 20u);
+        deallocate(ptr2, 24u);
+    }
+
+    TEST_F(ALuaAllocator, KeepsContentsWhenReallocatingBetweenSizeClassesAndHeap)
+    {
+        uint8_t* ptr = static_cast<uint8_t*>(allocate(10u));
+        for (uint8_t i = 0u; i < 10u; ++i)
+            ptr[i] = i;
+
+        size_t size = 10u;
+        for (size_t newSize : { 12u, 100u, 1000u, 5000u, 200u, 10u })
+        {
+            ptr = static_cast<uint8_t*>(reallocate(ptr, size, newSize));
+            ASSERT_NE(nullptr, ptr);
+            for (uint8_t i = 0u; i < 10u; ++i)
+                EXPECT_EQ(i, ptr[i]);
+            size = newSize;
+            EXPECT_EQ(size, m_allocator.getAllocatedBytes());
+        }
+
+        deallocate(ptr, size);
+    }
+
+    TEST_F(ALuaAllocator, KeepsBlockWhenShrinking)
+    {
+        void* ptr = allocate(200u);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_EQ(ptr, reallocate(ptr, 200u, 20u));
+        EXPECT_EQ(20u, m_allocator.getAllocatedBytes());
+
+        // still has capacity of its size class
+        EXPECT_EQ(ptr, reallocate(ptr, 20u, 200u));
+        EXPECT_EQ(200u, m_allocator.getAllocatedBytes());
+
+        deallocate(ptr, 200u);
+    }
+
+    TEST_F(ALuaAllocator, ReusesPooledBlockAfterAllBlocksWereFreed)
+    {
+        void* ptr = allocate(50u);
+        deallocate(ptr, 50u);
+        EXPECT_EQ(ptr, allocate(50u));
+        deallocate(ptr, 50u);
+    }
+
+    TEST_F(ALuaAllocator, ShrinksHeapBlockIntoSizeClassAndBack)
+    {
+        uint8_t* ptr = static_cast<uint8_t*>(allocate(3000u));
+        ASSERT_NE(nullptr, ptr);
+        for (uint8_t i = 0u; i < 5u; ++i)
+            ptr[i] = i;
+
+        ptr = static_cast<uint8_t*>(reallocate(ptr, 3000u, 5u));
+        ASSERT_NE(nullptr, ptr);
+        ptr = static_cast<uint8_t*>(reallocate(ptr, 5u, 2000u));
+        ASSERT_NE(nullptr, ptr);
+        for (uint8_t i = 0u; i < 5u; ++i)
+            EXPECT_EQ(i, ptr[i]);
+        EXPECT_EQ(2000u, m_allocator.getAllocatedBytes());
+
+        deallocate(ptr, 2000u);
+        EXPECT_EQ(0u, m_allocator.getAllocatedBytes());
+    }
+
+    TEST_F(ALuaAllocator, AccountsAllocationsToActiveAccount)
+    {
+        LuaMemoryAccountPtr account1 = m_allocator.createAccount();
+        LuaMemoryAccountPtr account2 = m_allocator.createAccount();
+
+        void* unattributed = allocate(10u);
+        void* ptr1 = nullptr;
+        void* ptr2 = nullptr;
+        {
+            LuaAllocator::ScopedAttribution attribution{ *account1 };
+            ptr1 = allocate(100u);
+            {
+                LuaAllocator::ScopedAttribution nestedAttribution{ *account2 };
+                ptr2 = allocate(1000u);
+            }
+            ptr1 = reallocate(ptr1, 100u, 200u);
+        }
+        EXPECT_EQ(200u, account1->usedBytes);
+        EXPECT_EQ(1000u, account2->usedBytes);
+        EXPECT_EQ(1210u, m_allocator.getAllocatedBytes());
+
+        // freeing is accounted to owner of block, regardless of active account
+        {
+            LuaAllocator::ScopedAttribution attribution{ *account2 };
+            deallocate(ptr1, 200u);
+        }
+        EXPECT_EQ(0u, account1->usedBytes);
+        EXPECT_EQ(1000u, account2->usedBytes);
+
+        deallocate(ptr2, 1000u);
+        deallocate(unattributed, 10u);
+        EXPECT_EQ(0u, account2->usedBytes);
+        EXPECT_EQ(0u, m_allocator.getAllocatedBytes());
+    }
+
+    TEST_F(ALuaAllocator, FailsGrowingAllocationsBeyondLimitOfActiveAccount)
+    {
+        LuaMemoryAccountPtr account = m_allocator.createAccount();
+        account->limit = 1000u;
+        LuaAllocator::ScopedAttribution attribution{ *account };
+
+        void* ptr = allocate(600u);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_FALSE(account->limitExceeded);
+
+        EXPECT_EQ(nullptr, allocate(500u));
+        EXPECT_TRUE(account->limitExceeded);
+        EXPECT_EQ(nullptr, reallocate(ptr, 600u, 1001u));
+        EXPECT_EQ(600u, account->usedBytes);
+
+        // growing up to limit and shrinking always succeeds
+        ptr = reallocate(ptr, 600u, 1000u);
+        ASSERT_NE(nullptr, ptr);
+        account->limit = 10u;
+        ptr = reallocate(ptr, 1000u, 500u);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_EQ(500u, account->usedBytes);
+
+        deallocate(ptr, 500u);
+    }
+
+    TEST_F(ALuaAllocator, KeepsReleasedAccountUntilAllItsMemoryIsFreed)
+    {
+        LuaMemoryAccountPtr account = m_allocator.createAccount();
+        void* ptr = nullptr;
+        {
+            LuaAllocator::ScopedAttribution attribution{ *account };
+            ptr = allocate(100u);
+        }
+
+        // owner is gone, its garbage is collected later
+        account.reset();
+        EXPECT_EQ(100u, m_allocator.getAllocatedBytes());
+        deallocate(ptr, 100u);
+        EXPECT_EQ(0u, m_allocator.getAllocatedBytes());
+    }
+}
@@ -92,6 +92,30 @@ namespace rlogic::internal
         EXPECT_TRUE(env["rl_logError"].valid());
     }
 
+    TEST_F(ASolState, IdentifiesLuaBackendOfByteCode)
+    {
+        auto load_result = m_solState.loadScript(m_valid_empty_script, "validEmptryScript");
+        ASSERT_TRUE(load_result.valid());
+        const sol::function mainFunction = load_result;
+        const sol::bytecode byteCode = mainFunction.dump();
+
+        EXPECT_EQ(SolState::GetLuaBackendName(), SolState::GetByteCodeBackendName(byteCode.as_string_view()));
+        EXPECT_EQ("Lua 5.1", SolState::GetByteCodeBackendName(std::string_view("\x1bLua\x51\x00", 6u)));
+        EXPECT_EQ("LuaJIT", SolState::GetByteCodeBackendName(std::string_view("\x1bLJ\x02", 4u)));
+        EXPECT_EQ("unknown", SolState::GetByteCodeBackendName(""));
+        EXPECT_EQ("unknown", SolState::GetByteCodeBackendName("return 1"));
+    }
+
+    TEST_F(ASolState, NewEnvironment_DoesNotExposeLuaJITLibraries)
+    {
+        sol::environment env = m_solState.createEnvironment(StandardModules(StdModules.cbegin(), StdModules.cend()), {}, false);
+        ASSERT_TRUE(env.valid());
+
+        EXPECT_FALSE(env["jit"].valid());
+        EXPECT_FALSE(env["ffi"].valid());
+        EXPECT_FALSE(env["bit"].valid());
+    }
+
     class ASolState_Environment : public ASolState
     {
     protected:
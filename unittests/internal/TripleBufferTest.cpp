@@ -0,0 +1,131 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/TripleBuffer.h"
+
+#include <thread>
+
+namespace rlogic::internal
+{
+    class ATripleBuffer : public ::testing::Test
+    {
+    protected:
+        ATripleBuffer()
+        {
+            m_buffer.reset(0);
+        }
+
+        void publish(int value)
+        {
+            m_buffer.getWriteBuffer() = value;
+            m_buffer.publish();
+        }
+
+        TripleBuffer<int> m_buffer;
+    };
+
+    TEST_F(ATripleBuffer, HasNothingToAcquireInitially)
+    {
+        EXPECT_FALSE(m_buffer.acquireLatest());
+        EXPECT_EQ(0, m_buffer.getReadBuffer());
+    }
+
+    TEST_F(ATripleBuffer, ReaderAcquiresPublishedValue)
+    {
+        publish(1);
+        EXPECT_EQ(0, m_buffer.getReadBuffer());
+        EXPECT_TRUE(m_buffer.acquireLatest());
+        EXPECT_EQ(1, m_buffer.getReadBuffer());
+
+        // same value is not acquired twice
+        EXPECT_FALSE(m_buffer.acquireLatest());
+        EXPECT_EQ(1, m_buffer.getReadBuffer());
+    }
+
+    TEST_F(ATripleBuffer, ReaderAcquiresOnlyLatestOfSeveralPublishedValues)
+    {
+        publish(1);
+        publish(2);
+        publish(3);
+        EXPECT_TRUE(m_buffer.acquireLatest());
+        EXPECT_EQ(3, m_buffer.getReadBuffer());
+        EXPECT_FALSE(m_buffer.acquireLatest());
+    }
+
+    TEST_F(ATripleBuffer, WriterDoesNotModifyValueHeldByReader)
+    {
+        publish(1);
+        ASSERT_TRUE(m_buffer.acquireLatest());
+
+        for (int i = 2; i < 10; ++i)
+        {
+            publish(i);
+            EXPECT_EQ(1, m_buffer.getReadBuffer());
+        }
+
+        EXPECT_TRUE(m_buffer.acquireLatest());
+        EXPECT_EQ(9, m_buffer.getReadBuffer());
+    }
+
+    TEST_F(ATripleBuffer, WriterCanReadLastPublishedValue)
+    {
+        EXPECT_EQ(0, m_buffer.getLastPublishedBuffer());
+        publish(1);
+        EXPECT_EQ(1, m_buffer.getLastPublishedBuffer());
+        ASSERT_TRUE(m_buffer.acquireLatest());
+        publish(2);
+        EXPECT_EQ(2, m_buffer.getLastPublishedBuffer());
+        EXPECT_EQ(1, m_buffer.getReadBuffer());
+    }
+
+    TEST_F(ATripleBuffer, ResetDiscardsPublishedValue)
+    {
+        publish(1);
+        m_buffer.reset(5);
+        EXPECT_FALSE(m_buffer.acquireLatest());
+        EXPECT_EQ(5, m_buffer.getReadBuffer());
+        EXPECT_EQ(5, m_buffer.getWriteBuffer());
+    }
+
+    TEST(ATripleBuffer_Concurrent, ReaderAlwaysSeesConsistentAndIncreasingValues)
+    {
+        // writer keeps both halves equal, reader must never observe a mix of two published values
+        struct Pair
+        {
+            uint64_t first = 0u;
+            uint64_t second = 0u;
+        };
+        TripleBuffer<Pair> buffer;
+        buffer.reset({});
+
+        constexpr uint64_t valueCount = 100000u;
+        std::thread writer([&buffer]() {
+            for (uint64_t i = 1u; i <= valueCount; ++i)
+            {
+                buffer.getWriteBuffer() = { i, i };
+                buffer.publish();
+            }
+        });
+
+        uint64_t lastValue = 0u;
+        while (lastValue < valueCount)
+        {
+            if (!buffer.acquireLatest())
+                continue;
+
+            const Pair& value = buffer.getReadBuffer();
+            ASSERT_EQ(value.first, value.second);
+            ASSERT_GT(value.first, lastValue);
+            lastValue = value.first;
+        }
+
+        writer.join();
+    }
+}
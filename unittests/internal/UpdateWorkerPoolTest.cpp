@@ -0,0 +1,58 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2022 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gmock/gmock.h"
+
+#include "internals/UpdateWorkerPool.h"
+
+#include <numeric>
+
+namespace rlogic::internal
+{
+    class AnUpdateWorkerPool : public ::testing::Test
+    {
+    protected:
+        UpdateWorkerPool m_pool{ 3u };
+    };
+
+    TEST_F(AnUpdateWorkerPool, ExecutesEachTaskExactlyOnce)
+    {
+        std::vector<std::atomic<int>> executions(1000u);
+        m_pool.execute(executions.size(), [&executions](size_t idx) { ++executions[idx]; });
+
+        for (const auto& e : executions)
+            EXPECT_EQ(1, e.load());
+    }
+
+    TEST_F(AnUpdateWorkerPool, CanBeReusedForManyBatches)
+    {
+        std::vector<size_t> results(64u, 0u);
+        for (size_t batch = 1u; batch <= 100u; ++batch)
+        {
+            m_pool.execute(results.size(), [&results](size_t idx) { results[idx] += idx; });
+            EXPECT_EQ(batch * (results.size() * (results.size() - 1u) / 2u), std::accumulate(results.cbegin(), results.cend(), size_t(0u)));
+        }
+    }
+
+    TEST_F(AnUpdateWorkerPool, ExecutesNothingForEmptyBatch)
+    {
+        bool executed = false;
+        m_pool.execute(0u, [&executed](size_t /*idx*/) { executed = true; });
+        EXPECT_FALSE(executed);
+    }
+
+    TEST(AnUpdateWorkerPool_WithoutWorkers, ExecutesTasksOnCallingThreadInOrder)
+    {
+        UpdateWorkerPool pool{ 0u };
+        EXPECT_EQ(0u, pool.getWorkerCount());
+
+        std::vector<size_t> order;
+        pool.execute(5u, [&order](size_t idx) { order.push_back(idx); });
+        EXPECT_THAT(order, ::testing::ElementsAre(0u, 1u, 2u, 3u, 4u));
+    }
+}
@@ -229,6 +229,37 @@ namespace rlogic::internal
     }
 
 
+    TEST_F(AWrappedLuaProperty_Access, ResolvesStructFieldsRepeatedlyWithKeysCreatedAtRuntime)
+    {
+        m_sol.open_libraries(sol::lib::base);
+        PropertyImpl inputAllPrimitives = makeTestProperty(m_structWithAllPrimitiveTypes, EPropertySemantics::ScriptInput);
+        WrappedLuaProperty wrapped(inputAllPrimitives);
+        m_sol["ROOT"] = std::ref(wrapped);
+
+        // keys built by concatenation are new Lua strings, collected keys can leave their address to other keys
+        const sol::protected_function_result result = run_WithResult(R"(
+            allValuesMatch = true
+            local prefix = "Int"
+            for i = 1, 50 do
+                local int32Value = ROOT[prefix .. "32"]
+                local int64Value = ROOT[prefix .. "64"]
+                local floatValue = ROOT.Float
+                if int32Value ~= 42 or int64Value ~= 421 or floatValue ~= 0.5 then
+                    allValuesMatch = false
+                end
+                collectgarbage("collect")
+            end
+        )");
+        ASSERT_TRUE(result.valid());
+        EXPECT_TRUE(m_sol["allValuesMatch"].get<bool>());
+
+        const sol::protected_function_result errorResult = run_WithResult("local prefix = 'Int' local value = ROOT[prefix .. '16']");
+        ASSERT_FALSE(errorResult.valid());
+        const sol::error err = errorResult;
+        EXPECT_THAT(err.what(), ::testing::HasSubstr("Tried to access undefined struct property 'Int16'"));
+    }
+
+
     class AWrappedLuaProperty_Assignment : public AWrappedLuaProperty_Access
     {
     protected: